@@ -30,7 +30,7 @@ void mhfmd_set_buzzer(const uint8_t state)
 {
     uint32_t duty;
     if (state) {
-        duty = (pow(2, LEDC_TIMER_5_BIT) - 1) / 2;
+        duty = ((1 << LEDC_TIMER_5_BIT) - 1) / 2;
     }
     else {
         duty = 0;
@@ -5,8 +5,21 @@
  * Compatible for use with: ESP32-WROOM-32.
  * @date 2023-04-19
  * 
- * @note The `frame` refers to a 2D-array with specific column and row
- * sizes for efficient SPI transfer. See st7735s_hal.h
+ * @note The `frame` refers to the back buffer, stored row by row with a
+ * stride of LCD_STRIDE pixels. See st7735s_hal.h
+ * @note With LCD_BAND_RENDERING, no frame is held in RAM: the drawing
+ * functions record the objects in a draw list, which is replayed onto each
+ * band of BAND_WIDTH columns at the next update of the display. The data
+ * pointed to by the objects (text, sprite) must then remain valid until
+ * st7735s_update_display() is called. Frames that do not start with
+ * st7735s_fill_background() add their drawings to the previous draw list.
+ * @note With LCD_DEFERRED_RENDERING, the drawings are recorded likewise, and
+ * binned into the tiles of BIN_SIZE x BIN_SIZE pixels they cover. At the
+ * next update of the display, only the bins whose drawings changed are
+ * drawn, each onto a scratch tile copied into the frame.
+ * @note With LCD_LAYER_CACHE (and neither of the above), the static layer
+ * is kept in an offscreen buffer that fills the frame in place of the
+ * background color. See st7735s_begin_layer().
  * @warning Do not modify any value between parenthesis '()'.
  */
 
@@ -16,6 +29,7 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <math.h>
 #include <assert.h>
 
@@ -30,6 +44,87 @@
 #define FIRST_ASCII         (' ')
 #define LAST_ASCII          ('Z')
 #define LUMA_THRESHOLD      45
+#define LUMA_SCALE          (1000)      // Scale of the integer luma coefficients
+
+
+/*************************************************
+ * Transparency parameters
+ *************************************************/
+#define ALPHA_BITS          (5)         // Bits of the alpha levels, at most 5 (see blend_pixels())
+#define ALPHA_MAX           (1 << ALPHA_BITS)   // Alpha level of an invisible drawing (0: opaque)
+
+
+/*************************************************
+ * Partial updates parameters
+ *************************************************/
+#define TILE_SIZE           (8)         // Side of the tiles used to track changes, in pixel
+#define NUM_TILES_X         (LCD_WIDTH / TILE_SIZE)
+#define NUM_TILES_Y         (LCD_HEIGHT / TILE_SIZE) // Must not exceed 16
+#define MAX_WINDOWS         (16)        // Max. CASET/RASET windows sent per frame, above it the whole frame is sent
+#define MAX_WINDOWS_AREA    50          // in %, above this area, the whole frame is sent
+
+
+/*************************************************
+ * Sprite encoding parameters
+ *************************************************/
+#define RLE_NUM_SPRITES     (48)        // Maximum number of run-length encoded sprites
+#define RLE_RUNS_SIZE       (4096)      // Bytes of opaque runs, shared by the encoded sprites
+#define RLE_LINES_SIZE      (1536)      // Line offsets, shared by the encoded sprites
+
+
+/*************************************************
+ * Circle parameters
+ *************************************************/
+#define CIRCLE_CACHE_SIZE   (8)         // Number of radii whose spans are cached
+
+
+/*************************************************
+ * Light map parameters
+ *************************************************/
+#define MAX_LIGHTS          (16)        // Maximum number of lights per frame
+#define LIGHT_SPANS_SIZE    (512)       // Spans of the light map, shared by its rows
+
+
+/*************************************************
+ * Head-up display parameters
+ *************************************************/
+#define HUD_MAX_CHARS       (8)         // Maximum number of characters of a widget
+#define HUD_WIDGET_WIDTH    (HUD_MAX_CHARS * (FONT_SIZE + TEXT_PADDING_X)) // in pixel
+
+
+/*************************************************
+ * Draw list parameters (see LCD_BAND_RENDERING, LCD_DEFERRED_RENDERING)
+ *************************************************/
+#define DRAW_LIST_SIZE      192         // Maximum number of drawings per frame, at most 256
+
+
+/*************************************************
+ * Deferred rendering parameters
+ *************************************************/
+/* Set to 1 to record the drawings into bins, drawn at the next update of
+ the display if they changed (see above). Requires a frame held in RAM, i.e.
+ LCD_BAND_RENDERING set to 0.*/
+#define LCD_DEFERRED_RENDERING  0
+#define BIN_SIZE            (16)        // Side of the bins, in pixel, a multiple of TILE_SIZE up to 16
+#define NUM_BINS_X          (LCD_WIDTH / BIN_SIZE)
+#define NUM_BINS_Y          (LCD_HEIGHT / BIN_SIZE)
+#define BIN_DEPTH           32          // Maximum number of drawings per bin
+
+#if (LCD_DEFERRED_RENDERING) && (LCD_BAND_RENDERING)
+    #error "LCD_DEFERRED_RENDERING requires LCD_BAND_RENDERING to be 0."
+#endif
+
+
+/*************************************************
+ * Layer cache parameters
+ *************************************************/
+/* Set to 1 to keep the static layer in an offscreen buffer of the size of
+ the display, shifted along with the scroll, so that only the columns it
+ exposes are drawn again (see st7735s_begin_layer()). Takes LCD_NPIX pixels
+ of heap, allocated at the first layer: without them, the static layer is
+ drawn at each frame. Ignored with LCD_BAND_RENDERING or
+ LCD_DEFERRED_RENDERING. */
+#define LCD_LAYER_CACHE     1
 
 
 /*************************************************
@@ -52,7 +147,9 @@
 /*************************************************
  * External variables
  *************************************************/
-extern uint16_t frame[NUM_TRANSACTIONS][PX_PER_TRANSACTION];
+#if !(LCD_BAND_RENDERING)
+extern uint16_t *frame;
+#endif
 
 
 /*************************************************
@@ -70,13 +167,15 @@ typedef struct {
     uint8_t height;         // Width in pixels        
     uint8_t width;          // Width in pixels        
     uint16_t color;         // 16-bit format
-    float alpha;          
+    uint8_t alpha;          // Transparency, from 0 (opaque) to ALPHA_MAX
 } rectangle_t;
 
 /**
  * @brief Circle object to be displayed onto the frame.
  * @note For a fully filled circle, use a thickness of 0. Else,
  * the circle thickness is drawn inwards.
+ * @note The circle covers the pixels (x, y) around its center such that
+ * |x| < radius and x² + y² + |y| < radius².
  */
 typedef struct {
     uint8_t pos_x;          // Center x-position      
@@ -84,9 +183,22 @@ typedef struct {
     uint8_t radius;         // Radius in pixels       
     uint8_t thickness;      // Thinkness in pixels    
     uint16_t color;         // 16-bit format
-    float alpha;
+    uint8_t alpha;          // Transparency, from 0 (opaque) to ALPHA_MAX
 } circle_t;
 
+/**
+ * @brief Light source, tinting the pixels around its center as a circle of
+ * its color and transparency would. See st7735s_draw_lights().
+ * @note The fields leave no padding, so that lights are hashed as bytes.
+ */
+typedef struct {
+    int16_t pos_x;          // Center x-position
+    int16_t pos_y;          // Center y-position
+    uint16_t color;         // 16-bit format
+    uint8_t radius;         // Radius in pixels
+    uint8_t alpha;          // Transparency, from 0 (opaque) to ALPHA_MAX
+} light_t;
+
 /**
  * @brief Text object to be displayed onto the frame. The size
  * parameter refer to the length of the text, in bytes.
@@ -99,29 +211,109 @@ typedef struct {
                                Dark on light background */
     uint16_t background;    // Background color, 0 for no background
     uint16_t color;         // Text color (16-bit format)
-    float alpha;      
+    uint8_t alpha;          // Transparency, from 0 (opaque) to ALPHA_MAX
     uint8_t size;           // Text size in bytes
     const uint8_t (*font)[FONT_SIZE];
     const char *data;       // Ptr to char array
 } text_t;
 
+/**
+ * @brief Orientations of a sprite that can be prebaked, i.e. stored as
+ * sprite data of their own. See indexed_data_t.
+ */
+typedef enum {
+    SPRITE_FLIP_X,          // Flipped on x-axis
+    SPRITE_FLIP_Y,          // Flipped on y-axis
+    SPRITE_FLIP_XY,         // Flipped on both axes
+    SPRITE_CW_90,           // 90° clockwise rotation
+    SPRITE_ACW_90,          // 90° anti-clockwise rotation
+    SPRITE_NUM_VARIANTS
+} sprite_variant_t;
+
+/**
+ * @brief Box of pixels in sprite data, from (x0, y0) to (x1, y1) included.
+ */
+typedef struct {
+    uint8_t x0;
+    uint8_t y0;
+    uint8_t x1;
+    uint8_t y1;
+} sprite_box_t;
+
+/**
+ * @brief Opacity of sprite data: which of its pixels are opaque, i.e. not
+ * black, or not of index 0 for indexed data.
+ * @note The boxes are not significant for transparent data.
+ */
+typedef struct {
+    enum {
+        SPRITE_MIXED,       // Opaque and transparent (black) pixels
+        SPRITE_OPAQUE,      // No transparent pixels
+        SPRITE_TRANSPARENT  // Transparent pixels only
+    } type;
+    sprite_box_t bounds;    // Bounding box of the opaque pixels
+    sprite_box_t opaque_box;    // Largest rectangle of opaque pixels
+} sprite_opacity_t;
+
+/**
+ * @brief Palette-indexed sprite data: each pixel is an index in a palette
+ * of colors, the index 0 standing for the transparent (black) pixels.
+ * @note With 4 bits per pixel, the pixels are packed by pairs into bytes,
+ * the left one in the high nibble. The rows are not padded.
+ * @note The variants are the data of the sprite as drawn with each
+ * orientation, NULL for the orientations that are not prebaked. They share
+ * the palette of the sprite.
+ * @note The opacity is measured along with the palette by the sprite
+ * compiler (see assets/tools/sprite_compiler.py).
+ */
+typedef struct indexed_data_s {
+    uint8_t bpp;            // Bits per pixel: 4 or 8
+    uint8_t num_colors;     // Number of colors of the palette, black included
+    sprite_opacity_t opacity;   // Opacity of the indices
+    const uint16_t *palette;    // Colors of the indices (16-bit format), BLACK first
+    const uint8_t *indices; // Palette indices, row by row
+    const struct indexed_data_s *const *variants;   // Prebaked orientations, by sprite_variant_t, or NULL
+} indexed_data_t;
+
 /**
  * @brief Sprite object to be displayed onto the frame.
+ * @note The sprite data is either given in the 16-bit format (`data`), or
+ * palette-indexed (`indexed`). The palette of indexed data can be replaced
+ * for one drawing (`palette`), e.g. for color variants.
  */
 typedef struct {
     uint8_t flip_x :    1;  // Flip sprite on x-axis
     uint8_t flip_y :    1;  // Flip sprite on y-axis
     uint8_t CW_90 :     1;  // 90° clockwise rotation
     uint8_t ACW_90 :    1;  // 90° anti-clockwise rotation
+    uint8_t opaque :    1;  // Draw the black pixels too
     uint8_t height;         // Width in pixels
     uint8_t width;          // Width in pixels
     int16_t pos_x;          // Top-left x-position
     int16_t pos_y;          // Top-left y-position
     uint16_t background_color;
-    float alpha;
+    uint8_t alpha;          // Transparency, from 0 (opaque) to ALPHA_MAX
     const uint16_t *data;   // Pointer to sprite data
+    const indexed_data_t *indexed;  // Pointer to palette-indexed sprite data, used instead of data
+    const uint16_t *palette;        // Palette replacing the one of the indexed data, NULL to keep it
 } sprite_t;
 
+/**
+ * @brief Widget of the head-up display: a label or a number, drawn as a
+ * text whose pixels are kept from one frame to the next.
+ * @note The fields after `num_digits` are managed by st7735s_draw_widget().
+ */
+typedef struct {
+    text_t text;            // Position, colors and font, and the label if num_digits is 0
+    uint8_t num_digits;     // Maximum number of digits of the value, 0 for a label
+    uint8_t rendered;       // 1 once the pixels are rendered
+    uint16_t value;         // Value of the rendered pixels
+    uint16_t background;    // Background color the pixels are rendered on
+    uint8_t width;          // Width of the rendered pixels
+    char chars[HUD_MAX_CHARS + 1];  // Characters of the value
+    uint16_t pixels[HUD_WIDGET_WIDTH * FONT_SIZE];
+} hud_widget_t;
+
 
 /*************************************************
  * Prototypes
@@ -131,6 +323,9 @@ typedef struct {
  * @brief Fill the background color of the frame.
  * 
  * @param[in] color Background color
+ * 
+ * @note The tiles of the frame are only filled once drawn upon, or at the
+ * update of the display. The tiles covered by opaque drawings are not.
  */
 void st7735s_fill_background(const uint16_t color);
 
@@ -148,6 +343,30 @@ void st7735s_draw_rectangle(const rectangle_t *rectangle);
  */
 void st7735s_draw_circle(const circle_t *circle);
 
+/**
+ * @brief Add a light source to the frame, drawn at the next call to
+ * st7735s_draw_lights().
+ * 
+ * @param[in] light Pointer to the light object to add.
+ * 
+ * @note Past MAX_LIGHTS lights, the lights added are ignored.
+ */
+void st7735s_add_light(const light_t *light);
+
+/**
+ * @brief Tint what is drawn on the frame so far with the lights added since
+ * the last call, in one pass.
+ * 
+ * @note The lights are composited into a light map: the spans of each row
+ * of the display with the same tint, so that each lit pixel is blended
+ * once. Overlapping lights combine as their circles drawn in turn would.
+ * Past LIGHT_SPANS_SIZE spans, the rows left are not lit.
+ * @note The light map is kept while the lights stay the same, or all move
+ * by the same distance along the x-axis, as with the camera. Draw the
+ * lights once per frame at most.
+ */
+void st7735s_draw_lights(void);
+
 /**
  * @brief Display a text on the frame.
  * 
@@ -164,11 +383,154 @@ void st7735s_draw_text(const text_t *text);
  * 
  * @param[in] sprite Pointer to the sprite object the draw.
  * 
- * @note  The color white, code 0xFFFF, is considered as 
+ * @note  The color black, code 0x0000, is considered as 
  * transparent by the function, and hence will not be sent
- * to the frame.
+ * to the frame, unless the sprite has a background color.
+ * @note The opaque runs of the rows and columns of the sprite data are
+ * encoded at the first drawing of the data, so that the transparent pixels
+ * are skipped at once. The data shall hence not be modified afterwards.
+ * Once RLE_NUM_SPRITES sprites are encoded, or when RLE_RUNS_SIZE or
+ * RLE_LINES_SIZE is exceeded, the other sprites are drawn pixel by pixel.
+ * @note The opacity of indexed data is given with the data, that of 16-bit
+ * data is measured along with its encoding: fully transparent sprites are
+ * skipped, only the bounding box of the opaque pixels is marked as changed,
+ * and the background is not filled under the largest rectangle of opaque
+ * pixels.
+ * @note Opaque sprites are copied as they are, black pixels included. Their
+ * data may be modified between two drawings.
+ * @note Palette-indexed data is expanded to the 16-bit format while drawn:
+ * the index 0 is transparent, as black is. The palette may be modified
+ * between two drawings, the indices may not.
+ * @note A flipped or rotated sprite whose indexed data has the variant of
+ * its orientation is drawn from the variant, as a sprite that is neither
+ * flipped nor rotated: its rows are copied straight.
  */
 void st7735s_draw_sprite(const sprite_t *sprite);
 
+/**
+ * @brief Draw a widget of the head-up display on the frame.
+ * 
+ * @param[in] widget Pointer to the widget object to draw.
+ * @param[in] value Value of the widget, ignored for a label.
+ * 
+ * @note The text of the widget is only rasterized when its value or the
+ * background color changes, and then copied onto the frame. Where other
+ * objects were drawn under the widget, it is drawn as a text instead.
+ * @note The value is formatted from a cache of the digit glyphs.
+ */
+void st7735s_draw_widget(hud_widget_t *widget, const uint16_t value);
+
+/**
+ * @brief Select the layer onto which the next drawings are made.
+ * 
+ * @param[in] enable 1 to draw on the static layer, 0 to draw on the
+ * dynamic layer (default).
+ * 
+ * @note The static layer is for content that only changes with the scroll
+ * of the frame, such as the scenery. It is not tracked: the display only
+ * receives it where it is scrolled in (see st7735s_scroll_frame()), or when
+ * the whole frame is sent. The static layer is sent entirely on the first
+ * frame drawing it, and after st7735s_invalidate_static_layer().
+ * @warning Only use the static layer on frames that start with
+ * st7735s_fill_background().
+ */
+void st7735s_set_static_layer(const uint8_t enable);
+
+/**
+ * @brief Notify that the static layer changes from the next frame on (e.g.
+ * new map, or removed elements restored), so that it is sent entirely.
+ * 
+ * @note Takes effect at the next call of st7735s_fill_background().
+ */
+void st7735s_invalidate_static_layer(void);
+
+/**
+ * @brief Start drawing the static layer: the next drawings are made on it
+ * until st7735s_end_layer().
+ * 
+ * @param[out] x0 Left-most x-position of the columns to draw.
+ * @param[out] x1 Right-most x-position of the columns to draw.
+ * @return 1 if the static layer is to be drawn from @p x0 to @p x1, 0 if it
+ * is up to date.
+ * 
+ * @note With LCD_LAYER_CACHE, the static layer is kept offscreen and moves
+ * along with st7735s_scroll_frame(). Only the columns it exposes, and the
+ * ones passed to st7735s_invalidate_layer(), are to be drawn again, and the
+ * drawings are clipped to them. Otherwise, the whole static layer is drawn
+ * on the frame at each frame.
+ * @warning Call it right after st7735s_fill_background().
+ */
+uint8_t st7735s_begin_layer(int16_t *x0, int16_t *x1);
+
+/**
+ * @brief Stop drawing the static layer, which becomes the background of
+ * the frame.
+ * 
+ * @warning Call it after each st7735s_begin_layer(), whatever it returned.
+ */
+void st7735s_end_layer(void);
+
+/**
+ * @brief Mark an area of the static layer as changed, e.g. when one of its
+ * elements is removed: the area is sent at the next update, whatever is
+ * drawn on it.
+ * 
+ * @param[in] pos_x Top-left x-position of the area, on the next frame.
+ * @param[in] pos_y Top-left y-position of the area.
+ * @param[in] width Width of the area in pixels.
+ * @param[in] height Height of the area in pixels.
+ * 
+ * @note Call it once per change, in every rendering mode. With
+ * LCD_LAYER_CACHE, the columns of the area are also drawn again on the
+ * cached static layer.
+ */
+void st7735s_invalidate_layer(const int16_t pos_x, const int16_t pos_y,
+                              const uint8_t width, const uint8_t height);
+
+/**
+ * @brief Scroll the frame along the x-axis. The content already displayed
+ * is shifted by the display itself at the next update, so that only the
+ * exposed columns and the dynamic layer are sent.
+ * 
+ * @param[in] dx Number of pixels by which the content moves to the left.
+ * Negative values move it to the right.
+ * 
+ * @note Scrolls of half the display width or more send the whole frame.
+ */
+void st7735s_scroll_frame(const int16_t dx);
+
+/**
+ * @brief Mark an area of the frame as changed, so that it is sent at the
+ * next update, e.g. when an element of the static layer is removed.
+ * 
+ * @param[in] pos_x Top-left x-position of the area.
+ * @param[in] pos_y Top-left y-position of the area.
+ * @param[in] width Width of the area in pixels.
+ * @param[in] height Height of the area in pixels.
+ */
+void st7735s_invalidate_area(const int16_t pos_x, const int16_t pos_y,
+                             const uint8_t width, const uint8_t height);
+
+/**
+ * @brief Send the frame to the display, and swap the frame buffers. Only
+ * the areas of the frame that changed since the last update are sent.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * 
+ * @note The changes are tracked on tiles of TILE_SIZE x TILE_SIZE pixels
+ * by the drawing functions. If too many tiles changed, the whole frame is
+ * sent instead. If nothing changed, nothing is sent.
+ * @note With LCD_DEFERRED_RENDERING, the bins are drawn onto the frame at
+ * this point. The bins whose drawings are the same as on the displayed frame
+ * are neither drawn nor sent, unless the frame scrolled.
+ * @note The transfer runs in the background. Call st7735s_wait_frame() to
+ * wait for its completion.
+ * @note Once st7735s_set_frame_rate() is called, the function first waits
+ * for the next refresh of the display, which paces the caller.
+ * @warning Use this function instead of st7735s_present_frame() once the
+ * drawing functions are used, so that the changes remain tracked.
+ */
+void st7735s_update_display(const spi_device_handle_t handle);
+
 
 #endif // __ST7735S_GRAPHICS_H__
\ No newline at end of file
@@ -18,10 +18,16 @@
 #include <math.h>
 #include <assert.h>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "driver/ledc.h"
 #include "esp_err.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "rom/ets_sys.h"
 
 
@@ -34,6 +40,8 @@
 #define PIN_LCD_RES         GPIO_NUM_2      // Reset                   
 #define PIN_LCD_DC          GPIO_NUM_15     // Register Selection      
 #define PIN_LCD_BKL         GPIO_NUM_17     // Background light  
+#define LCD_TE_WIRED        0               // 1 if the tearing effect output is wired to PIN_LCD_TE
+#define PIN_LCD_TE          GPIO_NUM_NC     // Tearing effect output, GPIO_NUM_NC if not wired
 
 
 /*************************************************
@@ -64,11 +72,11 @@
 #define RGBSET              (0x2D)          //
 #define RAMRD               (0x2E)          //
 #define PTLAR               (0x30)          //
-#define SCRLAR              (0x33)          //
+#define SCRLAR              (0x33)          // Scroll Area Set
 #define TEOFF               (0x34)          //
 #define TEON                (0x35)          //
 #define MADCTL              (0x36)          // Memory Data Access Control
-#define VSCSAD              (0x37)          //
+#define VSCSAD              (0x37)          // Vertical Scroll Start Address
 #define IDMOFF              (0x38)          //
 #define IDMON               (0x39)          //
 #define COLMOD              (0x3A)          // Interface Pixel Format
@@ -101,32 +109,38 @@
  * Display parameters
  ************************************************/
 #define LCD_MEMORY_BASE     0b11            // Display resolution code
-#define LCD_COLOR_FORMAT    (0x05)          // 16-bit/pixel            
+#define LCD_COLOR_FORMAT_12 (0x03)          // 12-bit/pixel
+#define LCD_COLOR_FORMAT_16 (0x05)          // 16-bit/pixel
+#define LCD_COLOR_FORMAT    LCD_COLOR_FORMAT_16 // Interface pixel format at initialization
 #define LCD_RTNA            0x00
 #define LCD_FPA             0x06
 #define LCD_BPA             0x03
 #define LCD_MH              0x00
 #define LCD_RGB             0x00            // 0x00: RGB; 0x01: BGR    
 #define LCD_ML              0x00
-#define LCD_MV              0x00
-#define LCD_MX              0x00            // X-Mirror                
-#define LCD_MY              0x01            // Y-Mirror                
+#define LCD_MV              0x01            // Row/column exchange: the columns are the x-axis
+#define LCD_MX              0x01            // X-Mirror                
+#define LCD_MY              0x00            // Y-Mirror                
 #define LCD_GAMMA           0x08            // Gamma Curve 4           
+#define LCD_OSC_FREQ        (850000)        // Oscillator frequency in Hz (see FRMCTR1)
+#define LCD_MIN_FRAME_RATE  45              // Lowest panel frame rate used for pacing, in Hz
 
 #if (LCD_MEMORY_BASE == 0b00)
     #define LCD_HEIGHT      (132)           /* pixels */
     #define LCD_WIDTH       (162)           /* pixels */
+    #define LCD_SIZE        (209)           /* pixels, diagonal rounded up */
 #elif (LCD_MEMORY_BASE == 0b01)
     #define LCD_HEIGHT      (132)           /* pixels */
     #define LCD_WIDTH       (132)           /* pixels */
+    #define LCD_SIZE        (187)           /* pixels, diagonal rounded up */
 #elif (LCD_MEMORY_BASE == 0b11)
     #define LCD_HEIGHT      (128)           /* pixels */
     #define LCD_WIDTH       (160)           /* pixels */ 
+    #define LCD_SIZE        (205)           /* pixels, diagonal rounded up */
 #else
     #error "LCD_MEMORY_BASE not recognized. Consult ST7735S datasheet."
 #endif
 #define LCD_NPIX            (LCD_HEIGHT * LCD_WIDTH)    // Number of pixels on the display
-#define LCD_SIZE            hypot(LCD_HEIGHT, LCD_WIDTH)
 
 #define PWM_LCD_MODE        LEDC_HIGH_SPEED_MODE
 #define PWM_LCD_RESOLUTION  LEDC_TIMER_4_BIT
@@ -137,13 +151,15 @@
 #define TEXT_PADDING_X      1               // pixels                  
 #define TEXT_PADDING_Y      3               // pixels   
 
+#define LCD_INIT_TASK_STACK     (2048)      // Stack of the display initialization task, in bytes
+#define LCD_INIT_TASK_PRIORITY  (5)         // Priority of the display initialization task
+
 
 /*************************************************
  * SPI parameters
  ************************************************/
 #define SPI_LCD_FREQUENCY   SPI_MASTER_FREQ_40M
 #define SPI_LCD_FLAGS       SPI_DEVICE_3WIRE
-#define SPI_LCD_QSIZE       1
 #define SPI_LCD_HOST        VSPI_HOST
 #define SPI_LCD_MODE        (0)
 /**
@@ -190,12 +206,65 @@
         #define NUM_TRANSACTIONS    (640)
     #endif
 #endif
-/* Maximum amount of 2-byte data sent per SPI transaction. Set for 
- 16-bit color format.*/
-#define PX_PER_TRANSACTION  (MAX_TRANSFER_SIZE / sizeof(uint16_t))
-/* Check how many pixels will remain in the last transaction
- (if 0, the last transaction is full)*/ 
-#define REMAINING_PIXELS    (LCD_NPIX % (MAX_TRANSFER_SIZE / sizeof(uint16_t)))
+// Number of pixels between two rows of the frame
+#define LCD_STRIDE          (LCD_WIDTH)
+/* Number of frame buffers (1 front buffer being sent + 1 back buffer being
+ drawn). The back buffer is allocated from the heap, see st7735s_wait_tft().*/
+#define NUM_FRAME_BUFFERS   (2)
+/* Queue size of the SPI device, allowing a whole frame and the commands of
+ its windows to be queued at once while the CPU keeps on drawing the next
+ frame.*/
+#define SPI_LCD_QSIZE       (NUM_TRANSACTIONS + 16)
+// Maximum number of parameters of a command in a command list, in byte
+#define LCD_MAX_PARAMETERS  (16)
+// Flags of the queued transactions, held in their user field
+#define LCD_TRANS_DATA      (1 << 0)        // Data transaction (D/C high), else command
+#define LCD_TRANS_LAST      (1 << 1)        // Last transaction of a frame
+/* Set to 1 to print the bytes sent per frame, the CPU time spent blocked on
+ the frame transfers, the CPU time freed by the asynchronous transfers, and
+ the overdraw: pixels written per frame over the pixels of the display.*/
+#define LCD_PROFILING       0
+// Number of frames over which the profiling results are averaged
+#define LCD_PROFILING_FRAMES    100
+/* Size, in pixels, of each of the two buffers used to gather the pixels of
+ a window before sending them (partial updates, 12-bit color format).*/
+#define LCD_STAGING_PIXELS  (1024)
+#define LCD_STAGING_BYTES   (LCD_STAGING_PIXELS * sizeof(uint16_t))
+// Size, in pixels, of the buffer repeating the color of the solid fills, must be even
+#define LCD_FILL_PIXELS     (1024)
+#define LCD_FILL_BYTES      (LCD_FILL_PIXELS * sizeof(uint16_t))
+/* Set to 1 to draw the frame band by band instead of holding a whole frame
+ in RAM (see st7735s_graphics.h). Only two bands are then held in RAM.*/
+#define LCD_BAND_RENDERING  0
+// Width of a band in pixels, must divide LCD_WIDTH
+#define BAND_WIDTH          (16)
+
+
+/*************************************************
+ * Data structures
+ *************************************************/
+
+/**
+ * @brief Rectangular area of the display, used to send partial updates
+ * of the frame.
+ */
+typedef struct {
+    uint8_t pos_x;          // Top-left x-position
+    uint8_t pos_y;          // Top-left y-position
+    uint8_t width;          // Width in pixels
+    uint8_t height;         // Height in pixels
+} window_t;
+
+/**
+ * @brief Command of a command list, sent to the ST7735S chip with its
+ * parameters.
+ */
+typedef struct {
+    uint8_t command;        // 8-bit command (see ST7735S datasheet p.104)
+    uint8_t num_parameters; // Number of parameters in byte
+    uint8_t parameters[LCD_MAX_PARAMETERS];
+    uint16_t delay;         // Delay after the command, in ms
+} lcd_command_t;
 
 
 /*************************************************
@@ -203,17 +272,24 @@
  *************************************************/
 
 /**
- * @brief 2D-array representing the display frame to be sent to the
- * TFT LCD screen. 
- * 
- * @note The array is sized specifically to get optimized
- * SPI transfer speed, effectively allowing the maximum amount of
- * bytes to be sent per transaction.
- * Both row and column sizes are determined at compile-time in
- * project_config.h, depending on the chosen SPI parameters and
- * display resolution.
+ * @brief Pointer to the display frame to be sent to the TFT LCD screen
+ * (back buffer).
+ * 
+ * @note The frame is stored row by row, in the scan order of the display
+ * (see LCD_MV): the pixel (x, y) is frame[y * LCD_STRIDE + x]. The frame is
+ * only split into SPI transactions of at most MAX_TRANSFER_SIZE bytes when
+ * it is sent.
+ * @note Two frame buffers are used: while the front buffer is being sent
+ * to the display by the SPI DMA, the next frame is drawn onto the back
+ * buffer. `frame` always points to the back buffer, and is swapped by
+ * st7735s_present_frame().
+ * @note If the back buffer cannot be allocated, `frame` is the only frame
+ * buffer: the frame is then fully sent before st7735s_present_frame()
+ * returns.
  */
-extern uint16_t frame[NUM_TRANSACTIONS][PX_PER_TRANSACTION];
+#if !(LCD_BAND_RENDERING)
+extern uint16_t *frame;
+#endif
 
 
 /*************************************************
@@ -242,20 +318,244 @@ void st7735s_set_backlight(uint8_t percentage);
 void st7735s_init_spi(spi_device_handle_t *handle);
 
 /**
- * @brief Initialize the TFT display.
+ * @brief Initialize the TFT display, and wait for its initialization to
+ * complete.
  * 
  * @param[in] handle SPI device handle of the display.
  */
 void st7735s_init_tft(const spi_device_handle_t handle);
 
 /**
- * @brief Send the frame to the ST7735S chip via SPI.
+ * @brief Queue a list of commands to be sent to the ST7735S chip, behind the
+ * commands and pixels already queued.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] commands Array of commands to send.
+ * @param[in] num_commands Number of commands in the array.
+ * 
+ * @note Each command and its parameters are queued as SPI transactions, the
+ * D/C line being set by the SPI pre-transaction callback. The function
+ * returns once the last command is queued, unless it has a delay: the
+ * function then waits for the commands to be sent, and for the delay.
+ * @warning Commands with more than 4 parameters must remain valid until
+ * they are sent, see st7735s_wait_frame().
+ */
+void st7735s_send_commands(const spi_device_handle_t handle, const lcd_command_t *commands,
+                           const uint8_t num_commands);
+
+/**
+ * @brief Start the initialization of the TFT display in a FreeRTOS task,
+ * and return immediately.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * 
+ * @note The ST7735S chip needs about 490 ms to reset and leave the sleep
+ * mode. The task sleeps during these delays, so that the CPU is free for
+ * the rest of the boot.
+ * @warning The display shall not be used before st7735s_wait_tft() returns.
+ */
+void st7735s_start_tft(const spi_device_handle_t handle);
+
+/**
+ * @brief Wait for the initialization of the TFT display started by
+ * st7735s_start_tft() to complete.
+ * 
+ * @note The back buffer of the frame is allocated from the heap here, once
+ * the rest of the console is initialized. If there is not enough memory
+ * left, the frames are drawn and sent from a single buffer (see `frame`).
+ */
+void st7735s_wait_tft(void);
+
+#if (LCD_BAND_RENDERING)
+/**
+ * @brief Get the x-position of the display where the scrolled columns of
+ * the ST7735S wrap around.
+ * 
+ * @return The x-position of the wrap, 0 if the display is not scrolled.
+ * 
+ * @note A band sent with st7735s_send_band() shall not cross this position.
+ */
+uint8_t st7735s_get_scroll_wrap(void);
+
+/**
+ * @brief Get the band buffer to draw onto. The band holds at most
+ * BAND_WIDTH columns of LCD_HEIGHT pixels each, stored row by row.
+ * 
+ * @return Pointer to the band buffer.
+ * 
+ * @note Two band buffers are used: while one is being sent to the display
+ * by the SPI DMA, the next band is drawn onto the other one.
+ */
+uint16_t *st7735s_get_band(void);
+
+/**
+ * @brief Send the band drawn onto the buffer returned by st7735s_get_band()
+ * to the ST7735S chip via SPI, and swap the band buffers.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] window Area of the display covered by the band, at most
+ * BAND_WIDTH pixels wide and not crossing st7735s_get_scroll_wrap().
+ * @param[in] last 1 if the band is the last one of the frame, else 0.
+ * 
+ * @note The band buffer holds the pixels of the window row by row, without
+ * gaps.
+ * @note The band is sent in the background by the SPI DMA.
+ */
+void st7735s_send_band(const spi_device_handle_t handle, const window_t *window,
+                       const uint8_t last);
+#else
+/**
+ * @brief Queue the frame to be sent to the ST7735S chip via SPI, and
+ * swap the frame buffers. The function returns as soon as the transfer
+ * is queued, the frame being sent in the background by the SPI DMA.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @note If a previous frame is still being sent, the function first waits
+ * for its transfer to complete.
+ * @note Transmits the data per transactions of 64 bytes if DMA is 
+ * disabled, 4092 bytes is enabled.
+ * @warning The content of the new back buffer is the one of the frame
+ * before last, or of the last frame with a single buffer. It shall be fully
+ * redrawn before being presented.
+ */
+void st7735s_present_frame(const spi_device_handle_t handle);
+
+/**
+ * @brief Send the given windows of the frame to the ST7735S chip via SPI,
+ * and swap the frame buffers. Each window is opened with its own column
+ * and row address range (CASET/RASET), and only its pixels are sent.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] windows Array of windows to send.
+ * @param[in] num_windows Number of windows in the array.
+ * 
+ * @note The pixels of the last window are sent in the background by the
+ * SPI DMA, like st7735s_present_frame().
+ * @note Windows that do not span the full height of the display are
+ * gathered into two ping-pong staging buffers before being sent.
+ */
+void st7735s_present_windows(const spi_device_handle_t handle, const window_t *windows,
+                             const uint8_t num_windows);
+
+/**
+ * @brief Copy the given windows of the front buffer (last frame presented)
+ * into the back buffer.
+ * 
+ * @param[in] windows Array of windows to copy. Input NULL to copy the whole
+ * frame.
+ * @param[in] num_windows Number of windows in the array.
+ * 
+ * @note This is used to bring the back buffer up to date with what is
+ * displayed when the next frame is not fully redrawn.
+ */
+void st7735s_sync_frame(const window_t *windows, const uint8_t num_windows);
+
+/**
+ * @brief Get the number of frame buffers in use.
+ * 
+ * @return 2 if the frame is double-buffered, 1 if the back buffer could
+ * not be allocated (see st7735s_wait_tft()).
+ */
+uint8_t st7735s_get_num_frame_buffers(void);
+#endif
+
+/**
+ * @brief Set the pixel format in which the frame is sent to the ST7735S
+ * chip. The frame is still drawn in RGB565.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] format LCD_COLOR_FORMAT_16 to send the pixels in RGB565, or
+ * LCD_COLOR_FORMAT_12 to pack them into RGB444 pairs of 3 bytes as they are
+ * sent, cutting the bytes per frame by 25% at the cost of color depth.
+ * 
+ * @note The content already displayed is kept. It is only sent in the new
+ * format where it is redrawn.
+ * @note The command is queued behind the pixels already queued.
+ * @note In 12-bit color format, the frame buffer is not sent as is: the
+ * pixels are packed into the staging buffers, or into the band buffer itself
+ * with LCD_BAND_RENDERING.
+ */
+void st7735s_set_color_format(const spi_device_handle_t handle, const uint8_t format);
+
+/**
+ * @brief Fill the given windows of the display with a solid color, without
+ * reading the frame.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] windows Array of windows to fill.
+ * @param[in] num_windows Number of windows in the array.
+ * @param[in] color Color of the windows (RGB565, as in the frame).
+ * @param[in] last 1 if the windows are the last ones of the frame, else 0.
+ * 
+ * @note The pixels are streamed from a buffer of LCD_FILL_PIXELS pixels
+ * repeating the color, queued as many times as needed. The windows are
+ * sent in the background by the SPI DMA.
+ * @note A new color waits for the previous fills to be sent, as the fill
+ * buffer is then rewritten.
+ */
+void st7735s_fill_windows(const spi_device_handle_t handle, const window_t *windows,
+                          const uint8_t num_windows, const uint16_t color, const uint8_t last);
+
+/**
+ * @brief Scroll the content of the display along the x-axis, using the
+ * vertical scrolling of the ST7735S chip.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] dx Number of pixels by which the content moves to the left.
+ * Negative values move it to the right.
+ * 
+ * @note The command is queued behind the pixels already queued. The
+ * windows sent afterwards are offset accordingly. The columns
+ * exposed by the scroll show the content that left the other side of the
+ * display, and shall be sent again.
+ * @note st7735s_present_frame() resets the scroll.
+ */
+void st7735s_scroll_display(const spi_device_handle_t handle, const int16_t dx);
+
+/**
+ * @brief Pace the presentation of the frames at the given frame rate.
+ * The panel frame rate is programmed to a multiple of it, and the frames
+ * are presented on its tearing effect (TE) signal.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] frame_rate Frame rate of the game, in Hz.
+ * 
+ * @note The panel refreshes at the lowest multiple of @p frame_rate that is
+ * at least LCD_MIN_FRAME_RATE, and a frame is presented every that many
+ * TE pulses. If LCD_TE_WIRED is 0, an esp_timer paces the frames.
+ * @note See st7735s_wait_refresh().
+ */
+void st7735s_set_frame_rate(const spi_device_handle_t handle, const uint8_t frame_rate);
+
+/**
+ * @brief Wait for the next refresh of the display at the frame rate set by
+ * st7735s_set_frame_rate(), so that the frame is sent during the vertical
+ * blanking of the panel, without tearing.
+ * 
+ * @note Returns immediately if the frame rate was not set, or if the refresh
+ * was already missed.
+ */
+void st7735s_wait_refresh(void);
+
+/**
+ * @brief Wait for the frame being sent to the ST7735S chip, if any, to
+ * be fully transferred.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ */
+void st7735s_wait_frame(const spi_device_handle_t handle);
+
+#if !(LCD_BAND_RENDERING)
+/**
+ * @brief Send the frame to the ST7735S chip via SPI at the next refresh of
+ * the display, and wait for the transfer to complete.
  * 
  * @param[in] handle SPI device handle of the display.
  * @note Transmits the data per transactions of 64 bytes if DMA is 
  * disabled, 4092 bytes is enabled.
  */
 void st7735s_push_frame(const spi_device_handle_t handle);
+#endif
 
 
 #endif // __ST7735S_HAL_H__
\ No newline at end of file
@@ -1,128 +1,613 @@
 #include "st7735s_graphics.h"
 
+/* Tiles are tracked as one 16-bit mask per column of tiles, where bit n
+ stands for the n-th tile along the y-axis. */
+static uint16_t painted_tiles[NUM_TILES_X] = {0};   // Tiles drawn since the frame was filled
+static uint16_t shown_tiles[NUM_TILES_X] = {0};     // Painted tiles of the displayed frame
+static uint16_t drawn_tiles[NUM_TILES_X] = {0};     // Tiles drawn since the frame was filled, static layer included
+static uint16_t invalid_tiles[NUM_TILES_X] = {0};   // Tiles to send at the next update, see st7735s_invalidate_layer()
+#if !(LCD_BAND_RENDERING)
+static uint16_t stale_tiles[NUM_TILES_X] = {0};     // Tiles of the back buffer that are outdated
+static uint8_t stale = 0;                           // 1 if any tile of the back buffer is outdated
+#endif
+static uint8_t filled = 0;                          // 1 if the frame was filled with background_color
+static uint8_t shown_filled = 0;                    // 1 if the displayed frame was filled with shown_background
+static uint16_t background_color, shown_background;
+static uint8_t static_layer = 0;                    // 1 while drawing the static layer
+static uint8_t static_drawn = 0;                    // 1 if the static layer was drawn on the frame
+static uint8_t static_shown = 0;                    // 1 if the displayed frame holds the static layer
+static uint8_t static_reset = 0;                    // 1 if the static layer changes at the next fill
+static int16_t scroll_dx = 0;                       // Scroll of the frame since the last update
+#if (LCD_PROFILING)
+static uint32_t drawn_pixels = 0;                   // Pixels written since the last report, background included
+static uint16_t drawn_frames = 0;
+#define COUNT_PIXELS(count) (drawn_pixels += (count))
+#else
+#define COUNT_PIXELS(count)
+#endif
+
+/**
+ * @brief Rectangular area, from (x0, y0) to (x1, y1) included. The area is
+ * empty if x1 < x0 or y1 < y0.
+ */
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} area_t;
+
+// 1 if the drawings are recorded in a draw list, and replayed onto a band or a scratch tile
+#define DRAW_LIST           (LCD_BAND_RENDERING || LCD_DEFERRED_RENDERING)
+
+#if !(DRAW_LIST)
+/* Tiles of the frame still to be filled with background_color: the fill is
+ deferred until the tiles are drawn upon, and skipped for the tiles covered
+ by opaque drawings. */
+static uint16_t unfilled_tiles[NUM_TILES_X] = {0};
+#endif
+
+// 1 if the static layer is kept in an offscreen buffer, see st7735s_begin_layer()
+#define LAYER_CACHE         (LCD_LAYER_CACHE && !DRAW_LIST)
+
+#if (LAYER_CACHE)
+static uint16_t *layer = NULL;                      // Static layer drawn on layer_background, row by row
+static uint8_t layer_allocated = 0;                 // 1 once the layer was allocated from the heap, or failed to
+static uint16_t layer_columns[LCD_WIDTH] = {0};     // Rows of tiles drawn upon, per column of the layer
+static uint16_t layer_background;
+static uint8_t layer_valid = 0;                     // 1 if the layer holds the static layer on layer_background
+static uint8_t layer_drawing = 0;                   // 1 while drawing onto the layer
+static uint8_t layer_filled = 0;                    // 1 if the frame is filled with the layer
+static int16_t layer_dx = 0;                        // Scroll of the frame since the layer was drawn
+static int16_t layer_x0, layer_x1;                  // Columns of the layer being drawn
+static int16_t invalid_x0 = LCD_WIDTH, invalid_x1 = -1;   // Columns to draw again at the next frame
+#endif
+
+#if (DRAW_LIST)
+/**
+ * @brief Drawing recorded in the draw list, to be replayed onto each band,
+ * or each bin it covers.
+ */
+typedef struct {
+    enum {
+        DRAW_RECTANGLE,
+        DRAW_CIRCLE,
+        DRAW_TEXT,
+        DRAW_SPRITE,
+        DRAW_LIGHTS         // The light map, see st7735s_draw_lights()
+    } type;
+    int16_t x0;             // Left-most x-position drawn
+    int16_t y0;             // Top-most y-position drawn
+    int16_t x1;             // Right-most x-position drawn
+    int16_t y1;             // Bottom-most y-position drawn
+#if (LCD_DEFERRED_RENDERING)
+    area_t cover;           // Area drawn with opaque pixels only, hiding what is under it
+    uint32_t hash;          // Hash of the object and of its data (see hash_draw())
+#endif
+    union {
+        rectangle_t rectangle;
+        circle_t circle;
+        text_t text;
+        sprite_t sprite;
+    };
+} draw_t;
+
+static draw_t draw_list[DRAW_LIST_SIZE];
+static uint16_t draw_count = 0;
+static uint16_t list_background = BLACK;           // Background color of the draw list
+static uint16_t *band = NULL;                       // Band (or scratch tile) being drawn
+static window_t band_window;                        // Area of the display covered by the band
+#endif
+
+#if (LCD_DEFERRED_RENDERING)
+#define NUM_BINS            (NUM_BINS_X * NUM_BINS_Y)
+
+static uint8_t bin_draws[NUM_BINS][BIN_DEPTH];      // Indices in draw_list of the drawings of each bin
+static uint8_t bin_counts[NUM_BINS] = {0};
+/* Signatures of the bins held by the front and back buffers, 0 if unknown
+ (see get_signatures()). */
+static uint32_t front_signatures[NUM_BINS] = {0};
+static uint32_t back_signatures[NUM_BINS] = {0};
+static uint16_t scratch_tile[BIN_SIZE * BIN_SIZE];  // Bin being drawn
+#endif
+
+/**
+ * @brief Run-length encoding of a sprite: the opaque runs of each of its
+ * rows and columns, stored as (first pixel, length) pairs of bytes in
+ * rle_runs. The runs of line n span rle_runs[offsets[n]] up to
+ * rle_runs[offsets[n + 1]], the offsets being stored in rle_lines.
+ */
+typedef struct {
+    const void *data;       // Sprite data the runs are encoded from, 16-bit or indexed
+    uint8_t width;
+    uint8_t height;
+    uint16_t rows;          // Index in rle_lines of the offsets of the rows
+    uint16_t columns;       // Index in rle_lines of the offsets of the columns
+    sprite_opacity_t opacity;   // Opacity of 16-bit data, indexed data having its own
+} rle_sprite_t;
+
+static rle_sprite_t rle_sprites[RLE_NUM_SPRITES];
+static uint8_t rle_count = 0;
+static uint8_t rle_runs[RLE_RUNS_SIZE];
+static uint16_t rle_runs_used = 0;
+static uint16_t rle_lines[RLE_LINES_SIZE];
+static uint16_t rle_lines_used = 0;
+
+/**
+ * @brief Runs of the lit pixels of a font row, from the left-most pixel.
+ */
+typedef struct {
+    uint8_t num_runs;
+    uint8_t start[(FONT_SIZE + 1) / 2];
+    uint8_t length[(FONT_SIZE + 1) / 2];
+} font_row_t;
+
+static font_row_t font_rows[1 << FONT_SIZE];        // Runs of each font row bit field
+/* Squared luma of each red, green and blue level, weighted by LUMA_SCALE
+ times their Rec. 601 coefficient. */
+static uint32_t luma_red[32], luma_green[64], luma_blue[32];
+static uint8_t text_tables = 0;                     // 1 once init_text_tables() was called
+
+/**
+ * @brief Glyphs of the digits, rendered with the colors of the last number
+ * widget drawn.
+ */
+static struct {
+    uint8_t valid;
+    const uint8_t (*font)[FONT_SIZE];
+    uint16_t color;
+    uint16_t background;
+    uint16_t pixels[10][FONT_SIZE * FONT_SIZE];
+} digit_glyphs;
+
+/**
+ * @brief Span of a row of the light map: pixels blended with the same tint.
+ */
+typedef struct {
+    int16_t x0;             // Left-most x-position of the span, before light_dx
+    int16_t x1;             // Right-most x-position of the span, before light_dx
+    uint8_t alpha;          // Transparency of the tint, from 0 (opaque) to ALPHA_MAX - 1
+    uint16_t color;         // Color of the tint, in big-endian format
+} light_span_t;
+
+static light_t lights[MAX_LIGHTS];                  // Lights added since the last light pass
+static uint8_t num_lights = 0;
+static light_t map_lights[MAX_LIGHTS];              // Lights composited into the light map
+static uint8_t map_num_lights = 0;
+/* Light map: the spans of row y are light_spans[light_rows[y]] up to
+ light_spans[light_rows[y + 1]], for the rows lit_y0 to lit_y1. */
+static light_span_t light_spans[LIGHT_SPANS_SIZE];
+static uint16_t light_rows[LCD_HEIGHT + 1];
+static int16_t lit_y0 = 0, lit_y1 = -1;
+static int16_t light_dx = 0;                        // Move of the lights since the light map was composited
+
+
 /**
- * @brief Convert the display coordinates to the st7735s driver's frame
- * coordinates.
+ * @brief Merge the given tiles into a list of windows. Vertical runs of
+ * tiles are merged with the identical runs of the neighbouring column.
  * 
- * @param[in] x Coordinate point on the x-axis of the display.
- * @param[in] y Coordinate point on the y-axis of the display.
- * @param[out] row Pointer to the row index of the frame.
- * @param[out] column Pointer to the column index of the frame.
- */
-static void get_frame_indexes(const int16_t x, const int16_t y,
-                              uint16_t *row, uint16_t *column)
-{
-    if (row == NULL) {
-        printf("Error(get_frame_indexes): `row` pointer is NULL.\n");
-        assert(row);
-    }
-    if (column == NULL) {
-        printf("Error(get_frame_indexes): `column` pointer is NULL.\n");
-        assert(column);
-    }
-    /*
-     Compute the amount of pixels to get to the pixel of position
-     (x, y). This parameter is required to figure out which row/column
-     of the frame the pixel will have to be placed in.
-    */
-    const uint16_t npixel = LCD_HEIGHT * x + (y + 1);
-    const uint16_t quotient = (uint16_t) npixel / PX_PER_TRANSACTION;
-    const uint16_t remainder = (uint16_t) npixel % PX_PER_TRANSACTION;
-    /*
-     Case A : display pixel (x, y): (0, 62) -> npixel  = 63 pixels
-     There are 32 pixels per row, hence row 0 is full, and row 1 is filled
-     up to 63 - 32 = 31 pixels, hence we're at column index 30.
-     Result: (0, 62) -> frame[1][30]
-    */
-    if (remainder) {
-        *row = quotient;
-        *column = remainder - 1;
-    }
-    /*
-     Case B : display pixel (x, y): (0, 63) -> npixel  = 64 pixels
-     There are 32 pixels per row, hence both row 0 and row 1 are full.
-     The pixel of position (0, 63) is at the end of the second row of the
-     frame.
-     Note: Using the remainder here is not possible, as any multiple of
-     PX_PER_TRANSACTION will give 0, which is not the column index we want.
-     Result: (0, 63) -> frame[1][31]
-    */
+ * @param[in] tiles Tile masks, one per column of tiles.
+ * @param[out] windows Array of at least MAX_WINDOWS windows.
+ * @param[out] num_windows Number of windows. MAX_WINDOWS + 1 if the tiles
+ * could not fit into MAX_WINDOWS windows.
+ * @return The number of tiles.
+ */
+static uint16_t get_windows(const uint16_t *tiles, window_t *windows,
+                            uint8_t *num_windows)
+{
+    if (num_windows == NULL) {
+        printf("Error(get_windows): `num_windows` pointer is NULL.\n");
+        assert(num_windows);
+    }
+    uint16_t num_tiles = 0;
+    *num_windows = 0;
+    for (uint8_t tile_x = 0; tile_x < NUM_TILES_X; tile_x++) {
+        uint8_t tile_y = 0;
+        while (tile_y < NUM_TILES_Y) {
+            if (!((tiles[tile_x] >> tile_y) & 1)) {
+                tile_y++;
+                continue;
+            }
+            const uint8_t start = tile_y;
+            while (tile_y < NUM_TILES_Y && ((tiles[tile_x] >> tile_y) & 1)) {
+                tile_y++;
+            }
+            num_tiles += tile_y - start;
+            if (MAX_WINDOWS < *num_windows) {
+                continue;
+            }
+            // Extend the window of the previous column if it has the same run
+            uint8_t i = 0;
+            while (i < *num_windows && !(windows[i].pos_x + windows[i].width == tile_x * TILE_SIZE &&
+                                         windows[i].pos_y == start * TILE_SIZE &&
+                                         windows[i].height == (tile_y - start) * TILE_SIZE)) {
+                i++;
+            }
+            if (i < *num_windows) {
+                windows[i].width += TILE_SIZE;
+            }
+            else if (*num_windows < MAX_WINDOWS) {
+                windows[i].pos_x = tile_x * TILE_SIZE;
+                windows[i].pos_y = start * TILE_SIZE;
+                windows[i].width = TILE_SIZE;
+                windows[i].height = (tile_y - start) * TILE_SIZE;
+                (*num_windows)++;
+            }
+            else {
+                *num_windows = MAX_WINDOWS + 1;
+            }
+        }
+    }
+    return num_tiles;
+}
+
+
+#if !(LCD_BAND_RENDERING)
+/**
+ * @brief Copy the outdated tiles of the back buffer from the frame being
+ * displayed, so that it can be drawn upon.
+ */
+static void sync_stale_tiles(void)
+{
+    window_t windows[MAX_WINDOWS];
+    uint8_t num_windows;
+    get_windows(stale_tiles, windows, &num_windows);
+    if (MAX_WINDOWS < num_windows) {
+        st7735s_sync_frame(NULL, 0);
+    }
     else {
-        *row = quotient - 1;
-        *column = PX_PER_TRANSACTION - 1;
+        st7735s_sync_frame(windows, num_windows);
     }
+    for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+        stale_tiles[i] = 0;
+    }
+    stale = 0;
 }
+#endif
 
 
+#if !(DRAW_LIST)
 /**
- * @brief Read the color value at the frame's given location, using the 
- * display coordinates as input.
+ * @brief Fill the unfilled tiles of a range of columns of tiles with the
+ * background color, or with the cached static layer once drawn.
  * 
- * @param[in] x Coordinate point on the x-axis of the display.
- * @param[in] y Coordinate point on the y-axis of the display.
- * @return The 16-bit color at the frame's location.
+ * @param tile_x0 Left-most column of tiles.
+ * @param tile_x1 Right-most column of tiles.
+ * @param mask Rows of tiles to fill.
+ * 
+ * @note The unfilled tiles of a row of tiles are filled by runs, each row
+ * of pixels of a run being written at once.
  */
-static uint16_t read_from_frame(const int16_t x, const int16_t y)
+static void fill_tiles(const uint8_t tile_x0, const uint8_t tile_x1, const uint16_t mask)
 {
-    if (x < 0 || LCD_WIDTH <= x || y < 0 || LCD_HEIGHT <= y ) {
-        printf("Error(read_from_frame): (x, y) coordinates are out of the frame.\n");
-        return 1;
+    for (uint8_t tile_y = 0; tile_y < NUM_TILES_Y; tile_y++) {
+        if (!((mask >> tile_y) & 1)) {
+            continue;
+        }
+        uint8_t tile_x = tile_x0;
+        while (tile_x <= tile_x1) {
+            if (!((unfilled_tiles[tile_x] >> tile_y) & 1)) {
+                tile_x++;
+                continue;
+            }
+            const uint8_t start = tile_x;
+            while (tile_x <= tile_x1 && ((unfilled_tiles[tile_x] >> tile_y) & 1)) {
+                unfilled_tiles[tile_x++] &= ~(1 << tile_y);
+            }
+            const uint16_t count = (tile_x - start) * TILE_SIZE;
+            for (uint8_t y = tile_y * TILE_SIZE; y < (tile_y + 1) * TILE_SIZE; y++) {
+                uint16_t *pixels = &frame[y * LCD_STRIDE + start * TILE_SIZE];
+#if (LAYER_CACHE)
+                if (layer_filled) {
+                    memcpy(pixels, &layer[y * LCD_WIDTH + start * TILE_SIZE], count * sizeof(uint16_t));
+                    continue;
+                }
+#endif
+                for (uint16_t x = 0; x < count; x++) {
+                    pixels[x] = background_color;
+                }
+            }
+            COUNT_PIXELS(count * TILE_SIZE);
+        }
     }
-    uint16_t row, column;
-    get_frame_indexes(x, y, &row, &column);
+}
+#endif
 
-    return SPI_SWAP_DATA_TX(frame[row][column], 16);
+
+/**
+ * @brief Clear the tiles fully covered by an opaque drawing from the tiles
+ * to fill with the background color, as the drawing overwrites them.
+ * 
+ * @param cover Area drawn with opaque pixels only.
+ */
+static void cover_tiles(const area_t *cover)
+{
+#if !(DRAW_LIST)
+#if (LAYER_CACHE)
+    if (layer_drawing) {
+        return;
+    }
+#endif
+    // Tiles fully within the area and the display
+    const int16_t tile_x0 = ((cover->x0 < 0) ? 0 : cover->x0 + TILE_SIZE - 1) / TILE_SIZE;
+    const int16_t tile_y0 = ((cover->y0 < 0) ? 0 : cover->y0 + TILE_SIZE - 1) / TILE_SIZE;
+    const int16_t tile_x1 = ((LCD_WIDTH <= cover->x1) ? LCD_WIDTH : cover->x1 + 1) / TILE_SIZE - 1;
+    const int16_t tile_y1 = ((LCD_HEIGHT <= cover->y1) ? LCD_HEIGHT : cover->y1 + 1) / TILE_SIZE - 1;
+    if (tile_x1 < tile_x0 || tile_y1 < tile_y0) {
+        return;
+    }
+    const uint16_t mask = (uint16_t)((1 << (tile_y1 + 1)) - (1 << tile_y0));
+    for (int16_t tile_x = tile_x0; tile_x <= tile_x1; tile_x++) {
+        unfilled_tiles[tile_x] &= ~mask;
+    }
+#endif
 }
 
 
 /**
- * @brief Write a pixel of information to the frame, taking the
- * cartesian coordinates of the display as input.
+ * @brief Mark the tiles covering an area of the display as drawn upon.
  * 
- * @param x Position of the pixel on the x-axis (along width)
- * @param y Position of the pixel on the y-axis (along height)
- * @param color Color of the pixel
- * @param alpha Transparency of the pixel. 0 means no transparency, 1 means full transparency.
+ * @param x0 Left-most position of the area on the x-axis.
+ * @param y0 Top-most position of the area on the y-axis.
+ * @param x1 Right-most position of the area on the x-axis.
+ * @param y1 Bottom-most position of the area on the y-axis.
  * 
- * @note The @p color parameter shall be in big-endian format.
+ * @note The area is clipped to the display.
+ * @note Must be called before drawing onto the frame, as it brings the
+ * back buffer up to date if needed, and fills the tiles of the area with the
+ * background color if they are not yet (see cover_tiles()).
+ * @note Nothing is marked as painted while drawing the static layer, unless
+ * the displayed frame does not hold it yet. The area is still marked as
+ * drawn, so that it is not taken for background.
+ * @note While drawing the cached static layer, the area is only marked on
+ * the layer.
  */
-static void write_to_frame(const int16_t x, const int16_t y,
-                           const uint16_t color, const float alpha)
+static void mark_area(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-    // Do not write if out of display's resolution
-    if (x < 0 || LCD_WIDTH <= x || y < 0 || LCD_HEIGHT <= y ) {
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    x1 = (LCD_WIDTH <= x1) ? LCD_WIDTH - 1 : x1;
+    y1 = (LCD_HEIGHT <= y1) ? LCD_HEIGHT - 1 : y1;
+    if (x1 < x0 || y1 < y0) {
         return;
     }
-
-    uint16_t row, column;
-    get_frame_indexes(x, y, &row, &column);
-    // Do not write if out of the frame's range
-    if ((NUM_TRANSACTIONS <= row) || (PX_PER_TRANSACTION <= column)) {
+    const uint16_t mask = (uint16_t)((1 << (y1 / TILE_SIZE + 1)) - (1 << (y0 / TILE_SIZE)));
+#if (LAYER_CACHE)
+    // The frame is marked once the layer is drawn, see st7735s_end_layer()
+    if (layer_drawing) {
+        for (int16_t x = (x0 < layer_x0) ? layer_x0 : x0; x <= x1 && x <= layer_x1; x++) {
+            layer_columns[x] |= mask;
+        }
         return;
     }
+#endif
+#if !(LCD_BAND_RENDERING)
+    if (stale) {
+        sync_stale_tiles();
+    }
+#endif
+#if !(DRAW_LIST)
+    fill_tiles(x0 / TILE_SIZE, x1 / TILE_SIZE, mask);
+#endif
+    for (uint8_t tile_x = x0 / TILE_SIZE; tile_x <= x1 / TILE_SIZE; tile_x++) {
+        drawn_tiles[tile_x] |= mask;
+    }
+    // The static layer is already displayed, except where it was scrolled in
+    if (static_layer) {
+        static_drawn = 1;
+        if (static_shown) {
+            return;
+        }
+    }
+    for (uint8_t tile_x = x0 / TILE_SIZE; tile_x <= x1 / TILE_SIZE; tile_x++) {
+        painted_tiles[tile_x] |= mask;
+    }
+}
+
+
+/**
+ * @brief Move tiles to the left along with the content of the display.
+ * 
+ * @param[in, out] tiles Tile masks, one per column of tiles.
+ * @param[in] dx Number of pixels by which the content moves to the left.
+ * 
+ * @note Unless @p dx is a multiple of TILE_SIZE, each tile overlaps two
+ * tiles once moved, and both are marked.
+ */
+static void shift_tiles(uint16_t *tiles, const int16_t dx)
+{
+    uint16_t shifted_tiles[NUM_TILES_X] = {0};
+    for (uint8_t tile_x = 0; tile_x < NUM_TILES_X; tile_x++) {
+        if (!tiles[tile_x]) {
+            continue;
+        }
+        int16_t x0 = tile_x * TILE_SIZE - dx;
+        int16_t x1 = x0 + TILE_SIZE - 1;
+        x0 = (x0 < 0) ? 0 : x0;
+        x1 = (LCD_WIDTH <= x1) ? LCD_WIDTH - 1 : x1;
+        for (int16_t x = x0; x <= x1; x += TILE_SIZE) {
+            shifted_tiles[x / TILE_SIZE] |= tiles[tile_x];
+        }
+        if (x0 <= x1) {
+            shifted_tiles[x1 / TILE_SIZE] |= tiles[tile_x];
+        }
+    }
+    for (uint8_t tile_x = 0; tile_x < NUM_TILES_X; tile_x++) {
+        tiles[tile_x] = shifted_tiles[tile_x];
+    }
+}
+
 
-    if (alpha == 0) {
-        frame[row][column] = color;
+/**
+ * @brief Mark an area given in 8-bit coordinates, as used by the drawing
+ * functions whose positions wrap around past 255.
+ * 
+ * @param x Left-most position of the area on the x-axis.
+ * @param y Top-most position of the area on the y-axis.
+ * @param width Width of the area.
+ * @param height Height of the area.
+ */
+static void mark_wrapped_area(const uint8_t x, const uint8_t y,
+                              const int16_t width, const int16_t height)
+{
+    if (width <= 0 || height <= 0) {
         return;
     }
-    // Apply transparency
-    const uint16_t color1 = (uint16_t)SPI_SWAP_DATA_TX(frame[row][column], 16);
-    const uint8_t red1 = (color1 >> 11);
-    const uint8_t green1 = (color1 >> 5 & 0b111111);
-    const uint8_t blue1 = (color1 & 0b11111);
+    const int16_t x1 = x + width - 1;
+    const int16_t y1 = y + height - 1;
+    mark_area(x, y, x1, y1);
+    if (UINT8_MAX < x1) {
+        mark_area(0, y, x1 - UINT8_MAX - 1, y1);
+    }
+    if (UINT8_MAX < y1) {
+        mark_area(x, 0, x1, y1 - UINT8_MAX - 1);
+    }
+    if (UINT8_MAX < x1 && UINT8_MAX < y1) {
+        mark_area(0, 0, x1 - UINT8_MAX - 1, y1 - UINT8_MAX - 1);
+    }
+}
+
+
+/**
+ * @brief Get the location of a pixel in the frame, or in the band being
+ * drawn when replaying the draw list (the scratch tile of a bin with
+ * LCD_DEFERRED_RENDERING), or in the columns of the cached static layer
+ * being drawn.
+ * 
+ * @param[in] x Coordinate point on the x-axis of the display.
+ * @param[in] y Coordinate point on the y-axis of the display.
+ * @return Pointer to the pixel, NULL if it is not held in RAM.
+ * 
+ * @warning The coordinates shall be within the display.
+ */
+static uint16_t *get_pixel(const int16_t x, const int16_t y)
+{
+#if (DRAW_LIST)
+    if (x < band_window.pos_x || band_window.pos_x + band_window.width <= x ||
+        y < band_window.pos_y || band_window.pos_y + band_window.height <= y) {
+        return NULL;
+    }
+    return &band[(y - band_window.pos_y) * band_window.width + (x - band_window.pos_x)];
+#else
+    // Do not write if out of the frame's range
+    if ((uint16_t)x >= LCD_WIDTH || (uint16_t)y >= LCD_HEIGHT) {
+        return NULL;
+    }
+#if (LAYER_CACHE)
+    if (layer_drawing) {
+        return (x < layer_x0 || layer_x1 < x) ? NULL : &layer[y * LCD_WIDTH + x];
+    }
+#endif
+    return &frame[y * LCD_STRIDE + x];
+#endif
+}
+
+
+/**
+ * @brief Clip an area of the display to the pixels held in RAM: the frame,
+ * the band being drawn when replaying the draw list, or the columns of the
+ * cached static layer being drawn.
+ * 
+ * @param x0 Pointer to the left-most x-position of the area.
+ * @param y0 Pointer to the top-most y-position of the area.
+ * @param x1 Pointer to the right-most x-position of the area.
+ * @param y1 Pointer to the bottom-most y-position of the area.
+ * @return 1 if part of the area is held in RAM, else 0.
+ */
+static uint8_t clip_area(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+#if (DRAW_LIST)
+    const int16_t left = band_window.pos_x, top = band_window.pos_y;
+    const int16_t right = band_window.pos_x + band_window.width - 1;
+    const int16_t bottom = band_window.pos_y + band_window.height - 1;
+#elif (LAYER_CACHE)
+    const int16_t left = layer_drawing ? layer_x0 : 0, top = 0;
+    const int16_t right = layer_drawing ? layer_x1 : LCD_WIDTH - 1, bottom = LCD_HEIGHT - 1;
+#else
+    const int16_t left = 0, top = 0, right = LCD_WIDTH - 1, bottom = LCD_HEIGHT - 1;
+#endif
+    *x0 = (*x0 < left) ? left : *x0;
+    *y0 = (*y0 < top) ? top : *y0;
+    *x1 = (right < *x1) ? right : *x1;
+    *y1 = (bottom < *y1) ? bottom : *y1;
+    return (*x0 <= *x1 && *y0 <= *y1);
+}
+
+
+/* Masks spreading the 6 fields of two RGB565 pixels over two words, with
+ at least ALPHA_BITS free bits above each field (see blend_pixels()). */
+#define BLEND_MASK_LOW      (0x07E0F81Fu)   // B0, R0, G1 in place
+#define BLEND_MASK_HIGH     (0x07C0F83Fu)   // G0, B1, R1 shifted right by 5 bits
+
+// Two pixels read or written at once, aliasing the 16-bit pixels of the frame
+typedef uint32_t __attribute__((may_alias)) pixel_pair_t;
+
+
+/**
+ * @brief Blend two colors onto two pixels of the frame at once.
+ * 
+ * @param pixels Two pixels of the frame, the first one in the low half.
+ * @param colors Two colors to blend onto the pixels, in the same layout.
+ * @param alpha Transparency of the colors, from 1 to ALPHA_MAX - 1.
+ * @return The two blended pixels.
+ * 
+ * @note The pixels and colors shall be in big-endian format.
+ */
+static inline uint32_t blend_pixels(uint32_t pixels, uint32_t colors, const uint32_t alpha)
+{
+    // Back to RGB565
+    pixels = ((pixels & 0x00FF00FF) << 8) | ((pixels >> 8) & 0x00FF00FF);
+    colors = ((colors & 0x00FF00FF) << 8) | ((colors >> 8) & 0x00FF00FF);
+    const uint32_t opacity = ALPHA_MAX - alpha;
+    const uint32_t low = (((colors & BLEND_MASK_LOW) * opacity +
+                           (pixels & BLEND_MASK_LOW) * alpha) >> ALPHA_BITS) & BLEND_MASK_LOW;
+    const uint32_t high = ((((colors >> 5) & BLEND_MASK_HIGH) * opacity +
+                            ((pixels >> 5) & BLEND_MASK_HIGH) * alpha) >> ALPHA_BITS) & BLEND_MASK_HIGH;
+    const uint32_t blended = low | (high << 5);
+    return ((blended & 0x00FF00FF) << 8) | ((blended >> 8) & 0x00FF00FF);
+}
 
-    const uint16_t color2 = (uint16_t)SPI_SWAP_DATA_TX(color, 16);
-    const uint8_t red2 = (color2 >> 11);
-    const uint8_t green2 = (color2 >> 5 & 0b111111);
-    const uint8_t blue2 = (color2 & 0b11111);
 
-    const uint8_t avg_red = alpha * red1 + (1-alpha) * red2;
-    const uint8_t avg_green = alpha * green1 + (1-alpha) * green2;
-    const uint8_t avg_blue = alpha * blue1 + (1-alpha) * blue2;
-    uint16_t avg_color = avg_red << 11 | avg_green << 5 | avg_blue;
-    avg_color = (uint16_t)SPI_SWAP_DATA_TX(avg_color, 16);
+/**
+ * @brief Blend a color onto a pixel of the frame.
+ * 
+ * @param pixel Pointer to the pixel of the frame.
+ * @param color Color to blend onto the pixel.
+ * @param alpha Transparency of the color, from 1 to ALPHA_MAX - 1.
+ * 
+ * @note The @p color parameter shall be in big-endian format.
+ */
+static void blend_pixel(uint16_t *pixel, const uint16_t color, const uint8_t alpha)
+{
+    *pixel = (uint16_t)blend_pixels(*pixel, color, alpha);
+}
+
 
-    frame[row][column] = avg_color;
+/**
+ * @brief Blend a color onto a row of pixels of the frame, two pixels at a
+ * time.
+ * 
+ * @param pixels Pointer to the left-most pixel of the row.
+ * @param color Color to blend onto the pixels, in big-endian format.
+ * @param count Number of pixels of the row.
+ * @param alpha Transparency of the color, from 1 to ALPHA_MAX - 1.
+ */
+static void blend_row(uint16_t *pixels, const uint16_t color, uint8_t count,
+                      const uint8_t alpha)
+{
+    // Align the row on 32 bits
+    if (count && ((uintptr_t)pixels & 2)) {
+        blend_pixel(pixels++, color, alpha);
+        count--;
+    }
+    const uint32_t colors = color | (uint32_t)color << 16;
+    pixel_pair_t *pairs = (pixel_pair_t *)pixels;
+    for (; 2 <= count; count -= 2, pairs++) {
+        *pairs = blend_pixels(*pairs, colors, alpha);
+    }
+    if (count) {
+        blend_pixel((uint16_t *)pairs, color, alpha);
+    }
 }
 
 
@@ -133,16 +618,15 @@ static void write_to_frame(const int16_t x, const int16_t y,
  * @return 1 if the color is considered dark, else 0.
  * 
  * @note The luma threshold can be modified in st7735s_graphics.h
+ * @note The tables of init_text_tables() shall be initialized.
  */
 static uint8_t is_color_dark(const uint16_t color)
 {
-    const uint8_t r = (color >> 11) & 0x1F;
-    const uint8_t g = (color >> 5) & 0x3F;
-    const uint8_t b = color & 0x1F;
     // https://en.wikipedia.org/wiki/Luma_(video)#Rec._601_luma_versus_Rec._709_luma_coefficients
-    float luma = sqrt(0.299 * r * r + 0.587 * g * g + 0.114 * b * b);
+    const uint32_t luma_2 = luma_red[(color >> 11) & 0x1F] + luma_green[(color >> 5) & 0x3F] +
+                            luma_blue[color & 0x1F];
     // Check if the perceived brightness is below the threshold
-    return (luma < LUMA_THRESHOLD);
+    return (luma_2 < LUMA_THRESHOLD * LUMA_THRESHOLD * LUMA_SCALE);
 }
 
 
@@ -165,235 +649,2288 @@ static void adapt_color(const uint16_t background, uint16_t *color)
 
 
 /**
- * @brief Rasterize 1 point-per-octant of a circle, for all
- * 8 octants.
+ * @brief Fill an area of the frame, or of the band being drawn, with a
+ * color.
  * 
- * @param circle Circle object to rasterize.
- * @param x Location of one point on the x-axis. 
- * @param y Location of one point on the y-axis.
+ * @param x0 Left-most x-position of the area.
+ * @param y0 Top-most y-position of the area.
+ * @param x1 Right-most x-position of the area.
+ * @param y1 Bottom-most y-position of the area.
+ * @param color Color of the area, in big-endian format.
+ * @param alpha Transparency of the color, from 0 (opaque) to ALPHA_MAX - 1.
+ */
+static void fill_area(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      const uint16_t color, const uint8_t alpha)
+{
+    if (!clip_area(&x0, &y0, &x1, &y1)) {
+        return;
+    }
+    const uint8_t count = x1 - x0 + 1;
+    COUNT_PIXELS(count * (y1 - y0 + 1));
+    for (int16_t y = y0; y <= y1; y++) {
+        uint16_t *pixels = get_pixel(x0, y);
+        if (alpha) {
+            blend_row(pixels, color, count, alpha);
+            continue;
+        }
+        for (uint8_t x = 0; x < count; x++) {
+            pixels[x] = color;
+        }
+    }
+}
+
 
+/**
+ * @brief Draw a rectangle on the frame, or on the band being drawn.
+ * 
+ * @param rectangle Rectangle object to draw.
  * 
- * @note It does not matter which initial position of one of the
- * 8 points is given as input, the function will draw the 8 pixels
- * independently. However, note that the (x, y) coordinates must 
- * belong to the same point.
+ * @note The positions past 255 wrap around, as for mark_wrapped_area().
  */
-static void rasterize_circle(const circle_t *circle, const uint8_t x,
-                             const uint8_t y)
+static void draw_rectangle(const rectangle_t *rectangle)
 {
-    if (circle == NULL) {
-        printf("Error(rasterize_circle): circle_t pointer is NULL.\n");
-        assert(circle);
+    if (!rectangle->width || !rectangle->height || ALPHA_MAX <= rectangle->alpha) {
+        return;
+    }
+    const int16_t x0 = rectangle->pos_x, y0 = rectangle->pos_y;
+    const int16_t x1 = x0 + rectangle->width - 1, y1 = y0 + rectangle->height - 1;
+    fill_area(x0, y0, x1, y1, rectangle->color, rectangle->alpha);
+    if (UINT8_MAX < x1) {
+        fill_area(0, y0, x1 - UINT8_MAX - 1, y1, rectangle->color, rectangle->alpha);
+    }
+    if (UINT8_MAX < y1) {
+        fill_area(x0, 0, x1, y1 - UINT8_MAX - 1, rectangle->color, rectangle->alpha);
+    }
+    if (UINT8_MAX < x1 && UINT8_MAX < y1) {
+        fill_area(0, 0, x1 - UINT8_MAX - 1, y1 - UINT8_MAX - 1, rectangle->color, rectangle->alpha);
     }
-    // Draw 8 pixels at once, one for each octant
-    write_to_frame((int16_t)circle->pos_x + x, (int16_t)circle->pos_y + y, circle->color, circle->alpha);
-    write_to_frame((int16_t)circle->pos_x + y, (int16_t)circle->pos_y + x, circle->color, circle->alpha);
-    write_to_frame((int16_t)circle->pos_x + y, (int16_t)circle->pos_y - x, circle->color, circle->alpha);
-    write_to_frame((int16_t)circle->pos_x + x, (int16_t)circle->pos_y - y, circle->color, circle->alpha);
-    write_to_frame((int16_t)circle->pos_x - x, (int16_t)circle->pos_y - y, circle->color, circle->alpha);
-    write_to_frame((int16_t)circle->pos_x - y, (int16_t)circle->pos_y - x, circle->color, circle->alpha);
-    write_to_frame((int16_t)circle->pos_x - y, (int16_t)circle->pos_y + x, circle->color, circle->alpha);
-    write_to_frame((int16_t)circle->pos_x - x, (int16_t)circle->pos_y + y, circle->color, circle->alpha);
 }
 
 
-void st7735s_fill_background(const uint16_t color)
+/**
+ * @brief Get the spans of a circle, computing them at the first drawing of
+ * its radius.
+ * 
+ * @param radius Radius of the circle, above 0.
+ * @return Pointer to the half-widths of the spans, one per row from the
+ * center row (0) to the top or bottom row (radius - 1).
+ * 
+ * @note The spans of CIRCLE_CACHE_SIZE radii are kept, replaced in turn. The
+ * spans returned stay valid across the next call.
+ */
+static const uint8_t *get_circle_spans(const uint8_t radius)
 {
-    for (int i = 0; i < NUM_TRANSACTIONS; i++) {
-        for (int j = 0; j < PX_PER_TRANSACTION; j++) {
-            frame[i][j] = color;
+    static uint8_t radii[CIRCLE_CACHE_SIZE] = {0};
+    static uint8_t spans[CIRCLE_CACHE_SIZE][UINT8_MAX];
+    static uint8_t next = 0;
+    for (uint8_t i = 0; i < CIRCLE_CACHE_SIZE; i++) {
+        if (radii[i] == radius) {
+            // Keep the spans just used until the next miss
+            next = (next == i) ? (i + 1) % CIRCLE_CACHE_SIZE : next;
+            return spans[i];
+        }
+    }
+    uint8_t *half_widths = spans[next];
+    radii[next] = radius;
+    next = (next + 1) % CIRCLE_CACHE_SIZE;
+    // Midpoint rule: row y spans the pixels x such that x² + y² + y < radius²
+    const int32_t radius_2 = (int32_t)radius * radius;
+    int32_t x = radius - 1;
+    for (int32_t y = 0; y < radius; y++) {
+        while (radius_2 <= x * x + y * y + y) {
+            x--;
         }
+        half_widths[y] = x;
     }
+    return half_widths;
 }
 
 
-void st7735s_draw_rectangle(const rectangle_t *rectangle)
+/**
+ * @brief Draw a span of a circle row, between the inner and the outer
+ * circles.
+ * 
+ * @param circle Circle object to draw.
+ * @param y Position of the row on the y-axis.
+ * @param outer Half-width of the outer circle on the row.
+ * @param inner Half-width of the inner circle on the row, -1 if the row is
+ * filled.
+ */
+static void draw_circle_row(const circle_t *circle, const int16_t y,
+                            const int16_t outer, const int16_t inner)
 {
-    if (rectangle == NULL) {
-        printf("Error(st7735s_draw_rectangle): rectangle_t pointer is NULL.\n");
-        assert(rectangle);
+    if (inner < 0) {
+        fill_area(circle->pos_x - outer, y, circle->pos_x + outer, y, circle->color, circle->alpha);
+        return;
     }
-    for (int y = 0; y < rectangle->height; y++) {
-        for (int x = 0; x < rectangle->width; x++) {
-            const uint8_t pos_x = rectangle->pos_x + x;
-            const uint8_t pos_y = rectangle->pos_y + y;
-            write_to_frame(pos_x, pos_y, rectangle->color, rectangle->alpha);
-        }
+    if (inner < outer) {
+        fill_area(circle->pos_x - outer, y, circle->pos_x - inner - 1, y, circle->color, circle->alpha);
+        fill_area(circle->pos_x + inner + 1, y, circle->pos_x + outer, y, circle->color, circle->alpha);
     }
 }
 
 
-void st7735s_draw_circle(const circle_t *circle)
+/**
+ * @brief Draw a circle on the frame, or on the band being drawn.
+ * 
+ * @param circle Circle object to draw.
+ * 
+ * @note The circle is drawn as horizontal spans, each pixel being written
+ * once. A ring is drawn as the spans of the outer circle not covered by the
+ * inner circle, of radius `radius - thickness`.
+ */
+static void draw_circle(const circle_t *circle)
 {
-    if (circle == NULL) {
-        printf("Error(st7735s_draw_circle): circle_t pointer is NULL.\n");
-        assert(circle);
+    if (!circle->radius || ALPHA_MAX <= circle->alpha) {
+        return;
     }
-    // https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
-    uint8_t y_out;
+    const uint8_t *outer = get_circle_spans(circle->radius);
     // No thickness means fully filled circle
-    if (circle->thickness == 0) {
-        for (uint8_t x = 0; x < circle->radius; x++) {
-            write_to_frame(circle->pos_x + x, circle->pos_y, circle->color, circle->alpha);
-            write_to_frame(circle->pos_x - x, circle->pos_y, circle->color, circle->alpha);
-            y_out = round(sqrt(pow(circle->radius, 2) - pow(x, 2)));
-            for (uint8_t y = 1; y < y_out; y++) {
-                if (x == 0) {
-                    write_to_frame(circle->pos_x, circle->pos_y + y, circle->color, circle->alpha);
-                    write_to_frame(circle->pos_x, circle->pos_y - y, circle->color, circle->alpha);
-                }
-                else {
-                    write_to_frame(circle->pos_x + x, circle->pos_y + y, circle->color, circle->alpha);
-                    write_to_frame(circle->pos_x + x, circle->pos_y - y, circle->color, circle->alpha);
-                    write_to_frame(circle->pos_x - x, circle->pos_y + y, circle->color, circle->alpha);
-                    write_to_frame(circle->pos_x - x, circle->pos_y - y, circle->color, circle->alpha);
-                }
-            }
-        }
-        return;
+    uint8_t inner_radius = 0;
+    if (circle->thickness && circle->thickness < circle->radius) {
+        inner_radius = circle->radius - circle->thickness;
     }
-    // Else, draw all 8 octants simultaneously
-    const uint8_t x_end = circle->radius * 0.707 + 1;
-    for (uint8_t x = 0; x < x_end; x++) {
-        // Outer circle
-        y_out = round(sqrt(pow(circle->radius, 2) - pow(x, 2)));
-        rasterize_circle(circle, x, y_out);
-        const uint8_t y_in = round(sqrt(pow(circle->radius - circle->thickness, 2) - pow(x, 2)));
-        rasterize_circle(circle, x, y_in);
-        for (uint8_t y = y_in + 1; y < y_out; y++) {
-            rasterize_circle(circle, x, y);
+    const uint8_t *inner = inner_radius ? get_circle_spans(inner_radius) : NULL;
+    for (int16_t y = 0; y < circle->radius; y++) {
+        const int16_t inner_width = (y < inner_radius) ? inner[y] : -1;
+        draw_circle_row(circle, circle->pos_y + y, outer[y], inner_width);
+        if (y) {
+            draw_circle_row(circle, circle->pos_y - y, outer[y], inner_width);
         }
     }
 }
 
 
-void st7735s_draw_text(const text_t *text)
+/**
+ * @brief Tint a span with a color, over its current tint.
+ * 
+ * @param span Span whose tint is set.
+ * @param color Color of the tint, in big-endian format.
+ * @param alpha Transparency of the tint, from 0 (opaque) to ALPHA_MAX - 1.
+ * 
+ * @note Blending the pixels with the tint of the span gives the same result
+ * as blending them with the current tint, then with the new one.
+ */
+static void tint_span(light_span_t *span, const uint16_t color, const uint8_t alpha)
 {
-    if (text == NULL) {
-        printf("Error(st7735s_draw_text): text_t pointer is NULL.\n");
-        assert(text);
-    }
-    if (text->data == NULL) {
-        printf("Error(st7735s_draw_text): text data pointer is NULL.\n");
-        assert(text->data);
+    if (span->alpha < ALPHA_MAX && span->color != color) {
+        // Weights of the current tint, seen through the new one, and of the new one
+        const uint32_t under = (ALPHA_MAX - span->alpha) * alpha;
+        const uint32_t over = (ALPHA_MAX - alpha) * ALPHA_MAX;
+        // Back to RGB565
+        const uint32_t colors[2] = {(uint16_t)(span->color << 8) | (span->color >> 8),
+                                    (uint16_t)(color << 8) | (color >> 8)};
+        const uint32_t masks[3] = {0xF800, 0x07E0, 0x001F};
+        uint16_t mixed = 0;
+        for (uint8_t i = 0; i < 3; i++) {
+            mixed |= (((colors[0] & masks[i]) * under + (colors[1] & masks[i]) * over) /
+                      (under + over)) & masks[i];
+        }
+        span->color = (uint16_t)(mixed << 8) | (mixed >> 8);
     }
-    if (text->font == NULL) {
-        printf("Error(st7735s_draw_text): text font pointer is NULL.\n");
-        assert(text->font);
+    else {
+        span->color = color;
     }
-    uint8_t px_pos_x, offset = 0;
-    uint8_t px_pos_y = text->pos_y;
-    for (uint8_t char_index = 0; char_index < text->size; char_index++) {
-        if (text->data[char_index] == '\0') {
-            break;
+    span->alpha = span->alpha * alpha / ALPHA_MAX;
+}
+
+
+/**
+ * @brief Composite the spans of a row of the light map from map_lights.
+ * 
+ * @param y Position of the row on the y-axis.
+ * @param used Number of spans of the light map already used.
+ * @return Number of spans used, the row included, or LIGHT_SPANS_SIZE + 1
+ * if the row does not fit.
+ * 
+ * @note The row is cut at the edges of the circles crossing it, each part
+ * being tinted by the circles covering it in turn. The circles cover the
+ * pixels drawn by draw_circle(). The spans are not clipped to the display,
+ * so that the light map can move along the x-axis.
+ */
+static uint16_t compose_light_row(const int16_t y, uint16_t used)
+{
+    int16_t x0[MAX_LIGHTS], x1[MAX_LIGHTS];
+    int16_t edges[2 * MAX_LIGHTS];
+    uint8_t num_edges = 0;
+    for (uint8_t i = 0; i < map_num_lights; i++) {
+        const light_t *light = &map_lights[i];
+        const int16_t dy = (y < light->pos_y) ? light->pos_y - y : y - light->pos_y;
+        x0[i] = 0;
+        x1[i] = -1;
+        if (!light->radius || ALPHA_MAX <= light->alpha || light->radius <= dy) {
+            continue;
         }
-        else if (text->data[char_index] == '\n') {
-            px_pos_y += FONT_SIZE + TEXT_PADDING_Y;
-            offset = char_index + 1;
+        const uint8_t half_width = get_circle_spans(light->radius)[dy];
+        x0[i] = light->pos_x - half_width;
+        x1[i] = light->pos_x + half_width;
+        // Edges sorted by insertion, each the first pixel of a part
+        const int16_t new_edges[2] = {x0[i], x1[i] + 1};
+        for (uint8_t n = 0; n < 2; n++) {
+            uint8_t j = num_edges++;
+            for (; j && new_edges[n] < edges[j - 1]; j--) {
+                edges[j] = edges[j - 1];
+            }
+            edges[j] = new_edges[n];
         }
-        else if (text->data[char_index] < FIRST_ASCII ||
-                 text->data[char_index] > LAST_ASCII) {
-            printf("Error: `%c`(0x%x) has no font sprite.\n",
-            text->data[char_index], text->data[char_index]);
+    }
+    for (uint8_t e = 0; e + 1 < num_edges; e++) {
+        if (edges[e] == edges[e + 1]) {
+            continue;
         }
-        else {
-            /* Using the character ascii code (ex:65 for 'A'), get the
-             corresponding letter sprite and iterate through each layer
-             of the sprite. */
-            const uint8_t sprite_index = text->data[char_index] - FIRST_ASCII;
-            for (uint8_t y = 0; y < FONT_SIZE; y++) {
-                uint8_t layer = text->font[sprite_index][y];
-                px_pos_y++;
-                // Extract each bit from bit field and write the pixel to the frame
-                for (int8_t bit = FONT_SIZE - 1; bit >= 0; bit--) {
-                    px_pos_x    = text->pos_x
-                                + (char_index - offset) * (FONT_SIZE + TEXT_PADDING_X)
-                                + (FONT_SIZE - 1 - bit);
-                    if (((layer >> bit) & 1) && text->adaptive) {
-                        uint16_t bg_color = read_from_frame(px_pos_x, px_pos_y);
-                        uint16_t color = text->color;
-                        adapt_color(bg_color, &color);
-                        write_to_frame(px_pos_x, px_pos_y, SPI_SWAP_DATA_TX(color, 16), text->alpha);
-                    }
-                    else if ((layer >> bit) & 1) {
-                        write_to_frame(px_pos_x, px_pos_y, text->color, text->alpha);
-                    }
-                    else if (text->background) {
-                        write_to_frame(px_pos_x, px_pos_y, text->background, text->alpha);
-                    }
-                }
-                // Fill background on x-padding
-                if (text->background) {
-                    for (uint8_t i = 0; i < TEXT_PADDING_X; i++) {
-                        px_pos_x =  text->pos_x
-                                    + (char_index - offset) * (FONT_SIZE + TEXT_PADDING_X)
-                                    - i - 1;
-                        write_to_frame(px_pos_x, px_pos_y, text->background, text->alpha);
-                        px_pos_x =  text->pos_x
-                                    + (char_index - offset) * (FONT_SIZE + TEXT_PADDING_X)
-                                    + FONT_SIZE + i;
-                        write_to_frame(px_pos_x, px_pos_y, text->background, text->alpha);
-                    }
-                }
+        light_span_t part = {edges[e], edges[e + 1] - 1, ALPHA_MAX, BLACK};
+        for (uint8_t i = 0; i < map_num_lights; i++) {
+            if (x0[i] <= part.x0 && part.x0 <= x1[i]) {
+                tint_span(&part, map_lights[i].color, map_lights[i].alpha);
             }
-            // Fill background on y-padding
-            if (text->background) {
-                for (uint8_t i = 0; i < TEXT_PADDING_Y; i++) {
-                    for (uint8_t j = 0; j < FONT_SIZE + 2 * TEXT_PADDING_X; j++) {
-                        px_pos_x =  text->pos_x
-                                    + (char_index - offset) * (FONT_SIZE + TEXT_PADDING_X)
-                                    - TEXT_PADDING_X + j;
-                        write_to_frame(px_pos_x, text->pos_y - i - 1, text->background, text->alpha);
-                        write_to_frame(px_pos_x, text->pos_y + FONT_SIZE + i, text->background, text->alpha);
-                    }
-                }
+        }
+        if (part.alpha == ALPHA_MAX) {
+            continue;
+        }
+        // Extend the previous span of the row if it has the same tint
+        if (0 < used && light_rows[y] < used) {
+            light_span_t *last = &light_spans[used - 1];
+            if (last->x1 + 1 == part.x0 && last->alpha == part.alpha && last->color == part.color) {
+                last->x1 = part.x1;
+                continue;
             }
-            px_pos_y -= FONT_SIZE;
         }
+        if (LIGHT_SPANS_SIZE <= used) {
+            return LIGHT_SPANS_SIZE + 1;
+        }
+        light_spans[used++] = part;
     }
+    return used;
 }
 
 
-void st7735s_draw_sprite(const sprite_t *sprite)
+/**
+ * @brief Composite the lights of map_lights into the light map.
+ */
+static void compose_light_map(void)
 {
-    if (sprite == NULL) {
-        printf("Error(st7735s_draw_sprite): sprite_t pointer is NULL.\n");
-        assert(sprite);
+    // Rows crossed by the circles
+    lit_y0 = LCD_HEIGHT;
+    lit_y1 = -1;
+    for (uint8_t i = 0; i < map_num_lights; i++) {
+        const light_t *light = &map_lights[i];
+        if (!light->radius || ALPHA_MAX <= light->alpha) {
+            continue;
+        }
+        const int16_t y0 = light->pos_y - light->radius + 1, y1 = light->pos_y + light->radius - 1;
+        lit_y0 = (y0 < lit_y0) ? y0 : lit_y0;
+        lit_y1 = (lit_y1 < y1) ? y1 : lit_y1;
     }
-    for (uint8_t y = 0; y < sprite->height; y++) {
-        for (uint8_t x = 0; x < sprite->width; x++) {
-            int16_t pos_x, pos_y;
-            if (sprite->flip_x) {
-                pos_x = sprite->pos_x + sprite->width - 1 - x;
-            }
-            else {
-                pos_x = sprite->pos_x + x;
-            }
-
-            if (sprite->flip_y) {
-                pos_y = sprite->pos_y + sprite->height - 1 - y;
-            }
-            else {
-                pos_y = sprite->pos_y + y;
+    lit_y0 = (lit_y0 < 0) ? 0 : lit_y0;
+    lit_y1 = (LCD_HEIGHT <= lit_y1) ? LCD_HEIGHT - 1 : lit_y1;
+    uint16_t used = 0;
+    for (int16_t y = lit_y0; y <= lit_y1; y++) {
+        light_rows[y] = used;
+        const uint16_t row_used = compose_light_row(y, used);
+        if (LIGHT_SPANS_SIZE < row_used) {
+            printf("Error(compose_light_map): light map is full, increase LIGHT_SPANS_SIZE.\n");
+            lit_y1 = y - 1;
+            break;
+        }
+        used = row_used;
+    }
+    light_rows[lit_y1 + 1] = used;
+    light_dx = 0;
+}
+
+
+/**
+ * @brief Check if the lights added are the lights of the light map, all
+ * moved by the same distance along the x-axis (e.g. by the camera).
+ * 
+ * @param[out] dx Distance by which the lights moved, in pixels.
+ * @return 1 if the light map only has to move by @p dx, else 0.
+ */
+static uint8_t is_light_map_moved(int16_t *dx)
+{
+    if (num_lights != map_num_lights) {
+        return 0;
+    }
+    *dx = num_lights ? lights[0].pos_x - map_lights[0].pos_x : 0;
+    for (uint8_t i = 0; i < num_lights; i++) {
+        const light_t *light = &lights[i], *map_light = &map_lights[i];
+        if (light->pos_x - map_light->pos_x != *dx || light->pos_y != map_light->pos_y ||
+            light->radius != map_light->radius || light->color != map_light->color ||
+            light->alpha != map_light->alpha) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+#if (LCD_DEFERRED_RENDERING)
+/**
+ * @brief Check if an area of the display holds pixels tinted by the light
+ * map.
+ * 
+ * @param x0 Left-most position of the area on the x-axis.
+ * @param y0 Top-most position of the area on the y-axis.
+ * @param x1 Right-most position of the area on the x-axis.
+ * @param y1 Bottom-most position of the area on the y-axis.
+ * @return 1 if a pixel of the area is tinted, else 0.
+ */
+static uint8_t is_area_lit(const int16_t x0, int16_t y0, const int16_t x1, int16_t y1)
+{
+    y0 = (y0 < lit_y0) ? lit_y0 : y0;
+    y1 = (lit_y1 < y1) ? lit_y1 : y1;
+    for (int16_t y = y0; y <= y1; y++) {
+        for (uint16_t s = light_rows[y]; s < light_rows[y + 1]; s++) {
+            if (light_spans[s].x0 + light_dx <= x1 && x0 <= light_spans[s].x1 + light_dx) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+#endif
+
+
+/**
+ * @brief Draw the light map on the frame, or on the band being drawn.
+ */
+static void draw_light_map(void)
+{
+    for (int16_t y = lit_y0; y <= lit_y1; y++) {
+        for (uint16_t s = light_rows[y]; s < light_rows[y + 1]; s++) {
+            const light_span_t *span = &light_spans[s];
+            fill_area(span->x0 + light_dx, y, span->x1 + light_dx, y, span->color, span->alpha);
+        }
+    }
+}
+
+
+/**
+ * @brief Expand the font row bit fields into runs of lit pixels, and
+ * compute the luma tables of is_color_dark().
+ */
+static void init_text_tables(void)
+{
+    for (uint8_t mask = 0; mask < (1 << FONT_SIZE); mask++) {
+        font_row_t *row = &font_rows[mask];
+        row->num_runs = 0;
+        uint8_t column = 0;
+        while (column < FONT_SIZE) {
+            // The left-most pixel is the most significant bit
+            if (!((mask >> (FONT_SIZE - 1 - column)) & 1)) {
+                column++;
+                continue;
+            }
+            const uint8_t start = column;
+            while (column < FONT_SIZE && ((mask >> (FONT_SIZE - 1 - column)) & 1)) {
+                column++;
+            }
+            row->start[row->num_runs] = start;
+            row->length[row->num_runs++] = column - start;
+        }
+    }
+    for (uint32_t level = 0; level < 64; level++) {
+        if (level < 32) {
+            luma_red[level] = 299 * level * level;
+            luma_blue[level] = 114 * level * level;
+        }
+        luma_green[level] = 587 * level * level;
+    }
+    text_tables = 1;
+}
+
+
+/**
+ * @brief Draw a horizontal span of a text.
+ * 
+ * @param x Left-most position of the span, wrapping around past 255.
+ * @param y Position of the span on the y-axis.
+ * @param count Number of pixels of the span.
+ * @param color Color of the span, in big-endian format.
+ * @param alpha Transparency of the color, from 0 (opaque) to ALPHA_MAX - 1.
+ */
+static void draw_text_span(const uint8_t x, const int16_t y, const uint8_t count,
+                           const uint16_t color, const uint8_t alpha)
+{
+    const int16_t x1 = x + count - 1;
+    fill_area(x, y, x1, y, color, alpha);
+    if (UINT8_MAX < x1) {
+        fill_area(0, y, x1 - UINT8_MAX - 1, y, color, alpha);
+    }
+}
+
+
+/**
+ * @brief Draw a run of adaptive text: each pixel is drawn white on a dark
+ * background, else with the text color.
+ * 
+ * @param text Text object to draw.
+ * @param pixels Pointer to the left-most pixel of the run.
+ * @param count Number of pixels of the run.
+ */
+static void draw_adaptive_run(const text_t *text, uint16_t *pixels, const uint8_t count)
+{
+    COUNT_PIXELS(count);
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t color = text->color;
+        adapt_color(SPI_SWAP_DATA_TX(pixels[i], 16), &color);
+        color = SPI_SWAP_DATA_TX(color, 16);
+        if (text->alpha) {
+            blend_pixel(&pixels[i], color, text->alpha);
+        }
+        else {
+            pixels[i] = color;
+        }
+    }
+}
+
+
+/**
+ * @brief Draw a run of text with a color.
+ * 
+ * @param pixels Pointer to the left-most pixel of the run.
+ * @param count Number of pixels of the run.
+ * @param color Color of the run, in big-endian format.
+ * @param alpha Transparency of the color, from 0 (opaque) to ALPHA_MAX - 1.
+ */
+static void draw_text_run(uint16_t *pixels, const uint8_t count, const uint16_t color,
+                          const uint8_t alpha)
+{
+    COUNT_PIXELS(count);
+    if (alpha) {
+        blend_row(pixels, color, count, alpha);
+        return;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        pixels[i] = color;
+    }
+}
+
+
+/**
+ * @brief Draw a span of adaptive text, clipped pixel by pixel.
+ * 
+ * @param text Text object to draw.
+ * @param x Left-most position of the span, wrapping around past 255.
+ * @param y Position of the span on the y-axis.
+ * @param count Number of pixels of the span.
+ */
+static void draw_adaptive_span(const text_t *text, uint8_t x, const uint8_t y,
+                               const uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++, x++) {
+        uint16_t *pixel = (x < LCD_WIDTH && y < LCD_HEIGHT) ? get_pixel(x, y) : NULL;
+        if (pixel != NULL) {
+            draw_adaptive_run(text, pixel, 1);
+        }
+    }
+}
+
+
+/**
+ * @brief Draw a row of a glyph, with the x-padding of its background.
+ * 
+ * @param text Text object to draw.
+ * @param x Position of the glyph on the x-axis, wrapping around past 255.
+ * @param y Position of the row on the y-axis.
+ * @param bits Bit field of the row, the left-most pixel being the most
+ * significant bit.
+ * @param inside 1 if the row and its padding are within the area held in
+ * RAM, so that they are drawn without clipping, else 0.
+ */
+static void draw_glyph_row(const text_t *text, const uint8_t x, const uint8_t y,
+                           const uint8_t bits, const uint8_t inside)
+{
+    const uint8_t row_mask = (1 << FONT_SIZE) - 1;
+    const font_row_t *lit = &font_rows[bits & row_mask];
+    const font_row_t *unlit = &font_rows[~bits & row_mask];
+    if (inside) {
+        uint16_t *pixels = get_pixel(x, y);
+        for (uint8_t i = 0; i < lit->num_runs; i++) {
+            if (text->adaptive) {
+                draw_adaptive_run(text, &pixels[lit->start[i]], lit->length[i]);
+            }
+            else {
+                draw_text_run(&pixels[lit->start[i]], lit->length[i], text->color, text->alpha);
+            }
+        }
+        if (text->background) {
+            for (uint8_t i = 0; i < unlit->num_runs; i++) {
+                draw_text_run(&pixels[unlit->start[i]], unlit->length[i], text->background, text->alpha);
+            }
+            // Fill background on x-padding
+            draw_text_run(pixels - TEXT_PADDING_X, TEXT_PADDING_X, text->background, text->alpha);
+            draw_text_run(pixels + FONT_SIZE, TEXT_PADDING_X, text->background, text->alpha);
+        }
+        return;
+    }
+    for (uint8_t i = 0; i < lit->num_runs; i++) {
+        if (text->adaptive) {
+            draw_adaptive_span(text, x + lit->start[i], y, lit->length[i]);
+        }
+        else {
+            draw_text_span(x + lit->start[i], y, lit->length[i], text->color, text->alpha);
+        }
+    }
+    if (text->background) {
+        for (uint8_t i = 0; i < unlit->num_runs; i++) {
+            draw_text_span(x + unlit->start[i], y, unlit->length[i], text->background, text->alpha);
+        }
+        // Fill background on x-padding
+        draw_text_span(x - TEXT_PADDING_X, y, TEXT_PADDING_X, text->background, text->alpha);
+        draw_text_span(x + FONT_SIZE, y, TEXT_PADDING_X, text->background, text->alpha);
+    }
+}
+
+
+/**
+ * @brief Draw a text on the frame, or on the band being drawn.
+ * 
+ * @param text Text object to draw.
+ * 
+ * @note The characters are laid out along the string, and each row of their
+ * glyph is drawn as the runs of its lit pixels (see init_text_tables()).
+ * @note The glyph rows are drawn one pixel below the position of their line.
+ * The y-padding of the background is drawn around the first line.
+ */
+static void draw_text(const text_t *text)
+{
+    if (ALPHA_MAX <= text->alpha) {
+        return;
+    }
+    if (!text_tables) {
+        init_text_tables();
+    }
+    uint8_t char_x = text->pos_x;
+    uint8_t line_y = text->pos_y;
+    for (uint8_t char_index = 0; char_index < text->size; char_index++, char_x += FONT_SIZE + TEXT_PADDING_X) {
+        const char character = text->data[char_index];
+        if (character == '\0') {
+            break;
+        }
+        else if (character == '\n') {
+            line_y += FONT_SIZE + TEXT_PADDING_Y;
+            // The next character is at the start of the line
+            char_x = text->pos_x - (FONT_SIZE + TEXT_PADDING_X);
+            continue;
+        }
+        else if (character < FIRST_ASCII || character > LAST_ASCII) {
+            printf("Error: `%c`(0x%x) has no font sprite.\n", character, character);
+            continue;
+        }
+        const uint8_t *glyph = text->font[character - FIRST_ASCII];
+        // Clip the glyph and its x-padding at once
+        int16_t x0 = char_x - TEXT_PADDING_X, x1 = char_x + FONT_SIZE + TEXT_PADDING_X - 1;
+        int16_t y0 = (uint8_t)(line_y + 1), y1 = y0 + FONT_SIZE - 1;
+        const int16_t box[4] = {x0, y0, x1, y1};
+        const uint8_t inside = clip_area(&x0, &y0, &x1, &y1) && box[0] == x0 && box[1] == y0 &&
+                               box[2] == x1 && box[3] == y1;
+        for (uint8_t y = 0; y < FONT_SIZE; y++) {
+            draw_glyph_row(text, char_x, line_y + 1 + y, glyph[y], inside);
+        }
+        // Fill background on y-padding
+        if (text->background) {
+            for (uint8_t i = 0; i < TEXT_PADDING_Y; i++) {
+                const uint8_t width = FONT_SIZE + 2 * TEXT_PADDING_X;
+                draw_text_span(char_x - TEXT_PADDING_X, text->pos_y - i - 1, width,
+                               text->background, text->alpha);
+                draw_text_span(char_x - TEXT_PADDING_X, text->pos_y + FONT_SIZE + i, width,
+                               text->background, text->alpha);
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief Get the palette index of a pixel of indexed sprite data.
+ * 
+ * @param indexed Palette-indexed sprite data.
+ * @param i Position of the pixel in the data, row by row.
+ * @return Palette index of the pixel, 0 if it is transparent.
+ */
+static inline uint8_t get_sprite_index(const indexed_data_t *indexed, const int32_t i)
+{
+    if (indexed->bpp == 4) {
+        // The left pixel of each pair is in the high nibble
+        return (i & 1) ? indexed->indices[i >> 1] & 0x0F : indexed->indices[i >> 1] >> 4;
+    }
+    return indexed->indices[i];
+}
+
+
+/**
+ * @brief Check if a pixel of the sprite data is opaque, i.e. not black, or
+ * not of index 0 for indexed data.
+ * 
+ * @param sprite Sprite object.
+ * @param i Position of the pixel in the data, row by row.
+ * @return 1 if the pixel is opaque, else 0.
+ */
+static inline uint8_t is_sprite_pixel_opaque(const sprite_t *sprite, const int32_t i)
+{
+    if (sprite->indexed != NULL) {
+        return get_sprite_index(sprite->indexed, i) != 0;
+    }
+    return sprite->data[i] != BLACK;
+}
+
+
+/**
+ * @brief Expand a run of palette-indexed sprite pixels read with a given
+ * step, onto a row of the frame.
+ * 
+ * @param dst Pointer to the left-most pixel of the row.
+ * @param sprite Sprite object, whose data is indexed.
+ * @param i Position in the data of the sprite pixel of the left-most pixel.
+ * @param step Step between two sprite pixels of the run, as for blit_strided().
+ * @param count Number of pixels of the run.
+ * @param background Color of the transparent pixels, 0 to skip them.
+ * 
+ * @note The transparent pixels are drawn black if the sprite is opaque.
+ */
+static void expand_run(uint16_t *dst, const sprite_t *sprite, int32_t i, const int16_t step,
+                       const uint8_t count, const uint16_t background)
+{
+    const indexed_data_t *indexed = sprite->indexed;
+    const uint16_t *palette = (sprite->palette != NULL) ? sprite->palette : indexed->palette;
+    for (uint8_t n = 0; n < count; n++, i += step) {
+        const uint8_t index = get_sprite_index(indexed, i);
+        uint16_t color = palette[index];
+        if (!index && !sprite->opaque) {
+            if (!background) {
+                continue;
+            }
+            color = background;
+        }
+        if (sprite->alpha) {
+            blend_pixel(&dst[n], color, sprite->alpha);
+        }
+        else {
+            dst[n] = color;
+        }
+        COUNT_PIXELS(1);
+    }
+}
+
+
+/**
+ * @brief Copy a run of sprite pixels read forward, onto a row of the frame.
+ * 
+ * @param dst Pointer to the left-most pixel of the row.
+ * @param src Pointer to the sprite pixel of the left-most pixel.
+ * @param count Number of pixels of the run.
+ * @param background Color of the black pixels, 0 to skip them.
+ * 
+ * @note The opaque pixels between two black pixels are copied at once.
+ */
+static void blit_forward(uint16_t *dst, const uint16_t *src, const uint8_t count,
+                         const uint16_t background)
+{
+    uint8_t i = 0;
+    while (i < count) {
+        uint8_t end = i;
+        while (end < count && src[end] != BLACK) {
+            end++;
+        }
+        if (i < end) {
+            memcpy(&dst[i], &src[i], (end - i) * sizeof(uint16_t));
+            COUNT_PIXELS(end - i);
+        }
+        for (i = end; i < count && src[i] == BLACK; i++) {
+            if (background) {
+                dst[i] = background;
+                COUNT_PIXELS(1);
             }
+        }
+    }
+}
+
+
+/**
+ * @brief Copy a run of sprite pixels read with a given step, onto a row of
+ * the frame.
+ * 
+ * @param dst Pointer to the left-most pixel of the row.
+ * @param src Pointer to the sprite pixel of the left-most pixel.
+ * @param step Step between two sprite pixels of the run, -1 when flipped
+ * horizontally, +/- the sprite width when rotated.
+ * @param count Number of pixels of the run.
+ * @param background Color of the black pixels, 0 to skip them.
+ */
+static void blit_strided(uint16_t *dst, const uint16_t *src, const int16_t step,
+                         const uint8_t count, const uint16_t background)
+{
+    for (uint8_t i = 0; i < count; i++, src += step) {
+        const uint16_t color = *src;
+        if (color != BLACK) {
+            dst[i] = color;
+            COUNT_PIXELS(1);
+        }
+        else if (background) {
+            dst[i] = background;
+            COUNT_PIXELS(1);
+        }
+    }
+}
 
-            if (sprite->CW_90) {
-                pos_x = sprite->pos_x + sprite->height - 1 - y;
-                pos_y = sprite->pos_y + x;
+
+/**
+ * @brief Blend a run of sprite pixels read with a given step, onto a row of
+ * the frame.
+ * 
+ * @param dst Pointer to the left-most pixel of the row.
+ * @param src Pointer to the sprite pixel of the left-most pixel.
+ * @param step Step between two sprite pixels of the run.
+ * @param count Number of pixels of the run.
+ * @param background Color of the black pixels, 0 to skip them.
+ * @param alpha Transparency of the sprite, from 1 to ALPHA_MAX - 1.
+ */
+static void blend_strided(uint16_t *dst, const uint16_t *src, const int16_t step,
+                          const uint8_t count, const uint16_t background, const uint8_t alpha)
+{
+    for (uint8_t i = 0; i < count; i++, src += step) {
+        const uint16_t color = (*src == BLACK) ? background : *src;
+        if (color != BLACK) {
+            blend_pixel(&dst[i], color, alpha);
+            COUNT_PIXELS(1);
+        }
+    }
+}
+
+
+/**
+ * @brief Encode the opaque runs of the lines (rows or columns) of a sprite.
+ * 
+ * @param sprite Sprite object.
+ * @param num_lines Number of lines to encode.
+ * @param length Number of pixels per line.
+ * @param line_step Step in the data between two lines.
+ * @param pixel_step Step in the data between two pixels of a line.
+ * @return Index in rle_lines of the offsets of the lines, -1 if there is
+ * not enough room left.
+ */
+static int32_t encode_lines(const sprite_t *sprite, const uint8_t num_lines, const uint8_t length,
+                            const uint16_t line_step, const uint16_t pixel_step)
+{
+    if (RLE_LINES_SIZE < rle_lines_used + num_lines + 1) {
+        return -1;
+    }
+    uint16_t *offsets = &rle_lines[rle_lines_used];
+    uint16_t used = rle_runs_used;
+    for (uint8_t n = 0; n < num_lines; n++) {
+        offsets[n] = used;
+        const int32_t line = n * line_step;
+        uint8_t i = 0;
+        while (i < length) {
+            while (i < length && !is_sprite_pixel_opaque(sprite, line + i * pixel_step)) {
+                i++;
+            }
+            const uint8_t start = i;
+            while (i < length && is_sprite_pixel_opaque(sprite, line + i * pixel_step)) {
+                i++;
             }
-            else if (sprite->ACW_90) {
-                pos_x = sprite->pos_x + y;
-                pos_y = sprite->pos_y + sprite->width - 1 - x;
+            if (start == i) {
+                continue;
             }
-            uint16_t color = sprite->data[y * sprite->width + x];
-            // Use black as transparency for sprites only
-            if (color == BLACK && sprite->background_color) {
-                color = sprite->background_color;
+            if (RLE_RUNS_SIZE < used + 2) {
+                return -1;
             }
-            else if (color == BLACK && !sprite->background_color) {
+            rle_runs[used++] = start;
+            rle_runs[used++] = i - start;
+        }
+    }
+    offsets[num_lines] = used;
+    rle_runs_used = used;
+    rle_lines_used += num_lines + 1;
+    return offsets - rle_lines;
+}
+
+
+/**
+ * @brief Measure the opacity of a sprite: whether it has transparent pixels,
+ * the bounding box of its opaque pixels, and its largest rectangle of opaque
+ * pixels.
+ * 
+ * @param[out] opacity Opacity of the sprite data.
+ * @param sprite Sprite object, whose data is in the 16-bit format.
+ * 
+ * @note The largest rectangle is found row by row, as the largest rectangle
+ * under the histogram of the opaque pixels above each row.
+ * @note Indexed data is measured by the sprite compiler, the same way.
+ */
+static void measure_opacity(sprite_opacity_t *opacity, const sprite_t *sprite)
+{
+    uint8_t heights[UINT8_MAX] = {0};           // Opaque pixels above each pixel of the row, itself included
+    uint16_t stack[UINT8_MAX + 1];
+    uint16_t num_opaque = 0, best = 0;
+    *opacity = (sprite_opacity_t){
+        .bounds = {sprite->width - 1, sprite->height - 1, 0, 0}
+    };
+    for (uint8_t y = 0; y < sprite->height; y++) {
+        for (uint8_t x = 0; x < sprite->width; x++) {
+            if (!is_sprite_pixel_opaque(sprite, y * sprite->width + x)) {
+                heights[x] = 0;
                 continue;
             }
-            write_to_frame(pos_x, pos_y, color, sprite->alpha);
+            heights[x]++;
+            num_opaque++;
+            sprite_box_t *bounds = &opacity->bounds;
+            bounds->x0 = (x < bounds->x0) ? x : bounds->x0;
+            bounds->y0 = (y < bounds->y0) ? y : bounds->y0;
+            bounds->x1 = (bounds->x1 < x) ? x : bounds->x1;
+            bounds->y1 = y;
+        }
+        // Each column ends the rectangles of the higher columns on its left
+        uint16_t top = 0;
+        for (uint16_t x = 0; x <= sprite->width; x++) {
+            const uint8_t height = (x < sprite->width) ? heights[x] : 0;
+            while (top && height <= heights[stack[top - 1]]) {
+                const uint8_t h = heights[stack[--top]];
+                const uint16_t left = top ? stack[top - 1] + 1 : 0;
+                if (best < h * (x - left)) {
+                    best = h * (x - left);
+                    opacity->opaque_box = (sprite_box_t){left, y - h + 1, x - 1, y};
+                }
+            }
+            stack[top++] = x;
+        }
+    }
+    if (num_opaque == 0) {
+        opacity->type = SPRITE_TRANSPARENT;
+    }
+    else if (num_opaque == sprite->width * sprite->height) {
+        opacity->type = SPRITE_OPAQUE;
+    }
+    else {
+        opacity->type = SPRITE_MIXED;
+    }
+}
+
+
+/**
+ * @brief Get the run-length encoding of a sprite, encoding it at its first
+ * drawing.
+ * 
+ * @param sprite Sprite object.
+ * @return Pointer to the encoding, NULL if it cannot be encoded.
+ */
+static const rle_sprite_t *get_rle_sprite(const sprite_t *sprite)
+{
+    const void *data = (sprite->indexed != NULL) ? (const void *)sprite->indexed : sprite->data;
+    for (uint8_t i = 0; i < rle_count; i++) {
+        if (rle_sprites[i].data == data && rle_sprites[i].width == sprite->width &&
+            rle_sprites[i].height == sprite->height) {
+            return &rle_sprites[i];
+        }
+    }
+    if (RLE_NUM_SPRITES <= rle_count) {
+        return NULL;
+    }
+    const uint16_t runs_used = rle_runs_used, lines_used = rle_lines_used;
+    const int32_t rows = encode_lines(sprite, sprite->height, sprite->width, sprite->width, 1);
+    const int32_t columns = encode_lines(sprite, sprite->width, sprite->height, 1, sprite->width);
+    if (rows < 0 || columns < 0) {
+        // Free the lines encoded before running out of room
+        rle_runs_used = runs_used;
+        rle_lines_used = lines_used;
+        return NULL;
+    }
+    rle_sprite_t *rle = &rle_sprites[rle_count++];
+    rle->data = data;
+    rle->width = sprite->width;
+    rle->height = sprite->height;
+    rle->rows = rows;
+    rle->columns = columns;
+    if (sprite->indexed == NULL) {
+        measure_opacity(&rle->opacity, sprite);
+    }
+    return rle;
+}
+
+
+/**
+ * @brief Get the opacity of a sprite data.
+ * 
+ * @param sprite Sprite object.
+ * @return Pointer to the opacity, given with indexed data, or measured at
+ * the encoding of 16-bit data. NULL if the data cannot be encoded.
+ */
+static const sprite_opacity_t *get_sprite_opacity(const sprite_t *sprite)
+{
+    if (sprite->indexed != NULL) {
+        return &sprite->indexed->opacity;
+    }
+    const rle_sprite_t *rle = get_rle_sprite(sprite);
+    return (rle != NULL) ? &rle->opacity : NULL;
+}
+
+
+/**
+ * @brief Copy a run of sprite pixels onto a row of the frame.
+ * 
+ * @param dst Pointer to the left-most pixel of the row.
+ * @param src Pointer to the sprite pixel of the left-most pixel.
+ * @param step Step between two sprite pixels of the run.
+ * @param count Number of pixels of the run.
+ * @param alpha Transparency of the sprite, from 0 (opaque) to ALPHA_MAX - 1.
+ * 
+ * @note All the pixels of the run are opaque.
+ */
+static void copy_run(uint16_t *dst, const uint16_t *src, const int16_t step,
+                     const uint8_t count, const uint8_t alpha)
+{
+    COUNT_PIXELS(count);
+    if (alpha) {
+        for (uint8_t i = 0; i < count; i++, src += step) {
+            blend_pixel(&dst[i], *src, alpha);
+        }
+    }
+    else if (step == 1) {
+        memcpy(dst, src, count * sizeof(uint16_t));
+    }
+    else {
+        for (uint8_t i = 0; i < count; i++, src += step) {
+            dst[i] = *src;
         }
     }
 }
+
+
+/**
+ * @brief Draw the opaque runs of a sprite within a clipped area.
+ * 
+ * @param sprite Sprite object to draw.
+ * @param rle Run-length encoding of the sprite data.
+ * @param x0 Left-most x-position of the clipped area.
+ * @param y0 Top-most y-position of the clipped area.
+ * @param x1 Right-most x-position of the clipped area.
+ * @param y1 Bottom-most y-position of the clipped area.
+ * 
+ * @note Each row of the display shows a row of the sprite, or a column of
+ * the sprite when it is rotated, read forward or backward.
+ */
+static void draw_sprite_runs(const sprite_t *sprite, const rle_sprite_t *rle,
+                             const int16_t x0, const int16_t y0, const int16_t x1, const int16_t y1)
+{
+    const uint8_t rotated = sprite->CW_90 || sprite->ACW_90;
+    const uint16_t *offsets = &rle_lines[rotated ? rle->columns : rle->rows];
+    const int16_t length = rotated ? rle->height : rle->width;
+    const int16_t line_step = rotated ? 1 : rle->width;
+    const int16_t pixel_step = rotated ? rle->width : 1;
+    // Line shown at the top of the sprite, and its direction along the x-axis
+    int16_t line, line_inc;
+    uint8_t reversed;
+    if (sprite->CW_90) {
+        line = 0;
+        line_inc = 1;
+        reversed = 1;
+    }
+    else if (sprite->ACW_90) {
+        line = rle->width - 1;
+        line_inc = -1;
+        reversed = 0;
+    }
+    else {
+        line = sprite->flip_y ? rle->height - 1 : 0;
+        line_inc = sprite->flip_y ? -1 : 1;
+        reversed = sprite->flip_x;
+    }
+    line += (y0 - sprite->pos_y) * line_inc;
+    for (int16_t y = y0; y <= y1; y++, line += line_inc) {
+        const int32_t first = line * line_step;
+        uint16_t *row = get_pixel(x0, y);
+        for (uint16_t r = offsets[line]; r < offsets[line + 1]; r += 2) {
+            const uint8_t start = rle_runs[r];
+            const uint8_t count = rle_runs[r + 1];
+            // Area of the display covered by the run, clipped
+            int16_t run_x0 = sprite->pos_x + (reversed ? length - start - count : start);
+            int16_t run_x1 = run_x0 + count - 1;
+            run_x0 = (run_x0 < x0) ? x0 : run_x0;
+            run_x1 = (x1 < run_x1) ? x1 : run_x1;
+            if (run_x1 < run_x0) {
+                continue;
+            }
+            const int16_t i = reversed ? length - 1 - (run_x0 - sprite->pos_x) : run_x0 - sprite->pos_x;
+            const int16_t step = reversed ? -pixel_step : pixel_step;
+            if (sprite->indexed != NULL) {
+                expand_run(&row[run_x0 - x0], sprite, first + i * pixel_step, step, run_x1 - run_x0 + 1, 0);
+            }
+            else {
+                copy_run(&row[run_x0 - x0], &sprite->data[first + i * pixel_step], step,
+                         run_x1 - run_x0 + 1, sprite->alpha);
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief Get the area of the display showing a box of the sprite data, as
+ * the sprite is oriented.
+ * 
+ * @param sprite Sprite object.
+ * @param box Box of the sprite data.
+ * @param[out] area Area of the display showing the box.
+ * 
+ * @note A rotation overrides the flips of the sprite, as in draw_sprite().
+ */
+static void get_sprite_area(const sprite_t *sprite, const sprite_box_t *box, area_t *area)
+{
+    const int16_t w = sprite->width, h = sprite->height;
+    if (sprite->CW_90) {
+        // The rows of the data are shown right to left
+        *area = (area_t){h - 1 - box->y1, box->x0, h - 1 - box->y0, box->x1};
+    }
+    else if (sprite->ACW_90) {
+        // The columns of the data are shown bottom to top
+        *area = (area_t){box->y0, w - 1 - box->x1, box->y1, w - 1 - box->x0};
+    }
+    else {
+        area->x0 = sprite->flip_x ? w - 1 - box->x1 : box->x0;
+        area->x1 = sprite->flip_x ? w - 1 - box->x0 : box->x1;
+        area->y0 = sprite->flip_y ? h - 1 - box->y1 : box->y0;
+        area->y1 = sprite->flip_y ? h - 1 - box->y0 : box->y1;
+    }
+    area->x0 += sprite->pos_x;
+    area->y0 += sprite->pos_y;
+    area->x1 += sprite->pos_x;
+    area->y1 += sprite->pos_y;
+}
+
+
+/**
+ * @brief Get the sprite to draw in place of a flipped or rotated sprite,
+ * from the prebaked variant of its orientation.
+ * 
+ * @param sprite Sprite object.
+ * @param[out] straight Sprite drawn from the variant, if there is one.
+ * @return Pointer to the sprite to draw: straight, or the sprite itself
+ * if it is not oriented or its orientation is not prebaked.
+ * 
+ * @note A rotation overrides the flips of the sprite, as in draw_sprite().
+ */
+static const sprite_t *get_straight_sprite(const sprite_t *sprite, sprite_t *straight)
+{
+    if (sprite->indexed == NULL || sprite->indexed->variants == NULL) {
+        return sprite;
+    }
+    sprite_variant_t variant;
+    if (sprite->CW_90) {
+        variant = SPRITE_CW_90;
+    }
+    else if (sprite->ACW_90) {
+        variant = SPRITE_ACW_90;
+    }
+    else if (sprite->flip_x) {
+        variant = sprite->flip_y ? SPRITE_FLIP_XY : SPRITE_FLIP_X;
+    }
+    else if (sprite->flip_y) {
+        variant = SPRITE_FLIP_Y;
+    }
+    else {
+        return sprite;
+    }
+    const indexed_data_t *indexed = sprite->indexed->variants[variant];
+    if (indexed == NULL) {
+        return sprite;
+    }
+    *straight = *sprite;
+    straight->indexed = indexed;
+    straight->flip_x = straight->flip_y = 0;
+    straight->CW_90 = straight->ACW_90 = 0;
+    if (sprite->CW_90 || sprite->ACW_90) {
+        // Rotations swap the width and the height of the sprite
+        straight->width = sprite->height;
+        straight->height = sprite->width;
+    }
+    return straight;
+}
+
+
+/**
+ * @brief Draw a sprite on the frame, or on the band being drawn.
+ * 
+ * @param sprite Sprite object to draw.
+ * 
+ * @note The sprite is clipped once, then drawn row by row of the frame: the
+ * orientation of the sprite only sets the steps through its data for one
+ * pixel right and one pixel down on the display. Only the opaque runs of
+ * the sprite are drawn when it is run-length encoded.
+ * @note A rotation overrides the flips of the sprite.
+ */
+static void draw_sprite(const sprite_t *sprite)
+{
+    const int16_t w = sprite->width;
+    const int16_t h = sprite->height;
+    // Rotations swap the width and the height of the sprite
+    const uint8_t rotated = sprite->CW_90 || sprite->ACW_90;
+    int16_t x0 = sprite->pos_x, y0 = sprite->pos_y;
+    int16_t x1 = x0 + (rotated ? h : w) - 1, y1 = y0 + (rotated ? w : h) - 1;
+    if (!w || !h || ALPHA_MAX <= sprite->alpha || !clip_area(&x0, &y0, &x1, &y1)) {
+        return;
+    }
+    // Black pixels are skipped at once, unless they are drawn
+    const rle_sprite_t *rle = (sprite->background_color || sprite->opaque) ? NULL : get_rle_sprite(sprite);
+    if (rle != NULL) {
+        draw_sprite_runs(sprite, rle, x0, y0, x1, y1);
+        return;
+    }
+    // Sprite pixel of the top-left corner, and steps along the display axes
+    int32_t origin;
+    int16_t step_x, step_y;
+    if (sprite->CW_90) {
+        origin = (h - 1) * w;
+        step_x = -w;
+        step_y = 1;
+    }
+    else if (sprite->ACW_90) {
+        origin = w - 1;
+        step_x = w;
+        step_y = -1;
+    }
+    else {
+        origin = (sprite->flip_x ? w - 1 : 0) + (sprite->flip_y ? (h - 1) * w : 0);
+        step_x = sprite->flip_x ? -1 : 1;
+        step_y = sprite->flip_y ? -w : w;
+    }
+    int32_t first = origin + (x0 - sprite->pos_x) * step_x + (y0 - sprite->pos_y) * step_y;
+    const uint8_t count = x1 - x0 + 1;
+    for (int16_t y = y0; y <= y1; y++, first += step_y) {
+        uint16_t *dst = get_pixel(x0, y);
+        if (sprite->indexed != NULL) {
+            expand_run(dst, sprite, first, step_x, count, sprite->background_color);
+            continue;
+        }
+        const uint16_t *src = &sprite->data[first];
+        if (sprite->opaque) {
+            copy_run(dst, src, step_x, count, sprite->alpha);
+        }
+        else if (sprite->alpha != 0) {
+            blend_strided(dst, src, step_x, count, sprite->background_color, sprite->alpha);
+        }
+        else if (step_x == 1) {
+            blit_forward(dst, src, count, sprite->background_color);
+        }
+        else {
+            blit_strided(dst, src, step_x, count, sprite->background_color);
+        }
+    }
+}
+
+
+/**
+ * @brief Check if an area of the frame only holds the background color, as
+ * nothing was drawn on it since the frame was filled.
+ * 
+ * @param x0 Left-most position of the area on the x-axis.
+ * @param y0 Top-most position of the area on the y-axis.
+ * @param x1 Right-most position of the area on the x-axis.
+ * @param y1 Bottom-most position of the area on the y-axis.
+ * @return 1 if the area only holds the background color, else 0.
+ */
+static uint8_t is_area_background(const int16_t x0, const int16_t y0,
+                                  const int16_t x1, const int16_t y1)
+{
+    if (!filled || x0 < 0 || y0 < 0 || LCD_WIDTH <= x1 || LCD_HEIGHT <= y1) {
+        return 0;
+    }
+    const uint16_t mask = (uint16_t)((1 << (y1 / TILE_SIZE + 1)) - (1 << (y0 / TILE_SIZE)));
+    for (uint8_t tile_x = x0 / TILE_SIZE; tile_x <= x1 / TILE_SIZE; tile_x++) {
+        if (drawn_tiles[tile_x] & mask) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/**
+ * @brief Render a glyph onto a block of pixels.
+ * 
+ * @param pixels Pointer to the top-left pixel of the block.
+ * @param stride Number of pixels between two rows of the block.
+ * @param glyph Bit fields of the glyph rows.
+ * @param color Color of the lit pixels.
+ * @param background Color of the other pixels.
+ */
+static void render_glyph(uint16_t *pixels, const uint8_t stride, const uint8_t *glyph,
+                         const uint16_t color, const uint16_t background)
+{
+    for (uint8_t y = 0; y < FONT_SIZE; y++, pixels += stride) {
+        for (uint8_t x = 0; x < FONT_SIZE; x++) {
+            pixels[x] = ((glyph[y] >> (FONT_SIZE - 1 - x)) & 1) ? color : background;
+        }
+    }
+}
+
+
+/**
+ * @brief Render the characters of a widget onto its pixels.
+ * 
+ * @param widget Widget object.
+ * @param chars Characters to render.
+ * @param num_chars Number of characters, at most HUD_MAX_CHARS.
+ * @param color Color of the lit pixels.
+ * 
+ * @note The digits of the number widgets are copied from the digit glyphs.
+ */
+static void render_widget(hud_widget_t *widget, const char *chars, const uint8_t num_chars,
+                          const uint16_t color)
+{
+    const uint8_t advance = FONT_SIZE + TEXT_PADDING_X;
+    widget->width = num_chars ? num_chars * advance - TEXT_PADDING_X : 0;
+    for (uint16_t i = 0; i < widget->width * FONT_SIZE; i++) {
+        widget->pixels[i] = widget->background;
+    }
+    if (widget->num_digits && !(digit_glyphs.valid && digit_glyphs.font == widget->text.font &&
+                                digit_glyphs.color == color && digit_glyphs.background == widget->background)) {
+        for (uint8_t digit = 0; digit < 10; digit++) {
+            render_glyph(digit_glyphs.pixels[digit], FONT_SIZE, widget->text.font['0' + digit - FIRST_ASCII],
+                         color, widget->background);
+        }
+        digit_glyphs.valid = 1;
+        digit_glyphs.font = widget->text.font;
+        digit_glyphs.color = color;
+        digit_glyphs.background = widget->background;
+    }
+    for (uint8_t i = 0; i < num_chars; i++) {
+        uint16_t *pixels = &widget->pixels[i * advance];
+        if (widget->num_digits) {
+            const uint16_t *glyph = digit_glyphs.pixels[chars[i] - '0'];
+            for (uint8_t y = 0; y < FONT_SIZE; y++) {
+                memcpy(&pixels[y * widget->width], &glyph[y * FONT_SIZE], FONT_SIZE * sizeof(uint16_t));
+            }
+        }
+        else if (FIRST_ASCII <= chars[i] && chars[i] <= LAST_ASCII) {
+            render_glyph(pixels, widget->width, widget->text.font[chars[i] - FIRST_ASCII], color,
+                         widget->background);
+        }
+    }
+}
+
+
+#if (LCD_DEFERRED_RENDERING)
+/**
+ * @brief Add bytes to a hash (FNV-1a).
+ * 
+ * @param hash Hash to add the bytes to.
+ * @param data Pointer to the bytes.
+ * @param size Number of bytes.
+ * @return The new hash.
+ */
+static uint32_t hash_bytes(uint32_t hash, const void *data, const uint16_t size)
+{
+    const uint8_t *bytes = data;
+    for (uint16_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+
+/**
+ * @brief Hash a drawing: the fields of its object, and the data it points
+ * to unless the data is constant.
+ * 
+ * @param draw Drawing to hash.
+ * @return The hash of the drawing.
+ * 
+ * @note The fields are hashed one by one, so that the padding bytes of the
+ * objects are left out. The sprite data is only hashed for the opaque
+ * sprites, whose data may change (see st7735s_draw_sprite()).
+ */
+static uint32_t hash_draw(const draw_t *draw)
+{
+    uint32_t hash = hash_bytes(2166136261u, &draw->type, sizeof(draw->type));
+    const void *pointer = NULL;
+    switch (draw->type) {
+        case DRAW_RECTANGLE: {
+            const rectangle_t *rectangle = &draw->rectangle;
+            const uint16_t fields[] = {rectangle->pos_x, rectangle->pos_y, rectangle->height,
+                                       rectangle->width, rectangle->color, rectangle->alpha};
+            hash = hash_bytes(hash, fields, sizeof(fields));
+            break;
+        }
+        case DRAW_CIRCLE: {
+            const circle_t *circle = &draw->circle;
+            const uint16_t fields[] = {circle->pos_x, circle->pos_y, circle->radius,
+                                       circle->thickness, circle->color, circle->alpha};
+            hash = hash_bytes(hash, fields, sizeof(fields));
+            break;
+        }
+        case DRAW_TEXT: {
+            const text_t *text = &draw->text;
+            const uint16_t fields[] = {text->pos_x, text->pos_y, text->adaptive, text->background,
+                                       text->color, text->alpha};
+            hash = hash_bytes(hash, fields, sizeof(fields));
+            pointer = text->font;
+            hash = hash_bytes(hash, &pointer, sizeof(pointer));
+            uint8_t length = 0;
+            while (length < text->size && text->data[length] != '\0') {
+                length++;
+            }
+            hash = hash_bytes(hash, text->data, length);
+            break;
+        }
+        case DRAW_SPRITE: {
+            const sprite_t *sprite = &draw->sprite;
+            const uint16_t fields[] = {sprite->flip_x, sprite->flip_y, sprite->CW_90, sprite->ACW_90,
+                                       sprite->opaque, sprite->height, sprite->width, sprite->pos_x,
+                                       sprite->pos_y, sprite->background_color, sprite->alpha};
+            hash = hash_bytes(hash, fields, sizeof(fields));
+            if (sprite->indexed != NULL) {
+                // The palette may be modified, the indices may not
+                const uint16_t *palette = (sprite->palette != NULL) ? sprite->palette : sprite->indexed->palette;
+                pointer = sprite->indexed;
+                hash = hash_bytes(hash, &pointer, sizeof(pointer));
+                hash = hash_bytes(hash, palette, sprite->indexed->num_colors * sizeof(uint16_t));
+                break;
+            }
+            pointer = sprite->data;
+            hash = hash_bytes(hash, &pointer, sizeof(pointer));
+            if (sprite->opaque) {
+                hash = hash_bytes(hash, sprite->data, sprite->width * sprite->height * sizeof(uint16_t));
+            }
+            break;
+        }
+        case DRAW_LIGHTS:
+            hash = hash_bytes(hash, map_lights, map_num_lights * sizeof(light_t));
+            break;
+        default: break;
+    }
+    return hash;
+}
+#endif
+
+
+#if (DRAW_LIST)
+/**
+ * @brief Record a drawing in the draw list, to be replayed onto each band,
+ * or onto each bin it covers, at the next update of the display.
+ * 
+ * @param draw Drawing to record.
+ * @param x0 Left-most x-position drawn.
+ * @param y0 Top-most y-position drawn.
+ * @param x1 Right-most x-position drawn.
+ * @param y1 Bottom-most y-position drawn.
+ * @param cover Area drawn with opaque pixels only, NULL if none. Used with
+ * LCD_DEFERRED_RENDERING only.
+ * 
+ * @note Positions past 255 wrap around for the objects using 8-bit
+ * positions, hence these drawings are replayed onto all the bands, or all
+ * the bins of their rows or columns.
+ */
+static void record_draw(draw_t *draw, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                        const area_t *cover)
+{
+    if (DRAW_LIST_SIZE <= draw_count) {
+        printf("Error(record_draw): draw list is full, increase DRAW_LIST_SIZE.\n");
+        return;
+    }
+    if (UINT8_MAX < x1) {
+        x0 = 0;
+        x1 = LCD_WIDTH - 1;
+    }
+    if (UINT8_MAX < y1) {
+        y0 = 0;
+        y1 = LCD_HEIGHT - 1;
+    }
+    draw->x0 = x0;
+    draw->y0 = y0;
+    draw->x1 = x1;
+    draw->y1 = y1;
+#if (LCD_DEFERRED_RENDERING)
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    x1 = (LCD_WIDTH <= x1) ? LCD_WIDTH - 1 : x1;
+    y1 = (LCD_HEIGHT <= y1) ? LCD_HEIGHT - 1 : y1;
+    if (x1 < x0 || y1 < y0) {
+        return;
+    }
+    draw->cover = (cover != NULL) ? *cover : (area_t){0, 0, -1, -1};
+    draw->hash = hash_draw(draw);
+    for (uint8_t bin_y = y0 / BIN_SIZE; bin_y <= y1 / BIN_SIZE; bin_y++) {
+        for (uint8_t bin_x = x0 / BIN_SIZE; bin_x <= x1 / BIN_SIZE; bin_x++) {
+            const uint8_t bin = bin_y * NUM_BINS_X + bin_x;
+            // The light map is only replayed onto the bins it tints
+            if (draw->type == DRAW_LIGHTS && !is_area_lit(bin_x * BIN_SIZE, bin_y * BIN_SIZE,
+                                                          (bin_x + 1) * BIN_SIZE - 1,
+                                                          (bin_y + 1) * BIN_SIZE - 1)) {
+                continue;
+            }
+            if (BIN_DEPTH <= bin_counts[bin]) {
+                printf("Error(record_draw): bin is full, increase BIN_DEPTH.\n");
+                continue;
+            }
+            bin_draws[bin][bin_counts[bin]++] = draw_count;
+        }
+    }
+#endif
+    draw_list[draw_count++] = *draw;
+}
+
+
+/**
+ * @brief Replay a drawing of the draw list onto the band being drawn.
+ * 
+ * @param draw Drawing to replay.
+ */
+static void replay_draw(const draw_t *draw)
+{
+    if (draw->x1 < band_window.pos_x || band_window.pos_x + band_window.width <= draw->x0 ||
+        draw->y1 < band_window.pos_y || band_window.pos_y + band_window.height <= draw->y0) {
+        return;
+    }
+    switch (draw->type) {
+        case DRAW_RECTANGLE: draw_rectangle(&draw->rectangle); break;
+        case DRAW_CIRCLE: draw_circle(&draw->circle); break;
+        case DRAW_TEXT: draw_text(&draw->text); break;
+        case DRAW_SPRITE: draw_sprite(&draw->sprite); break;
+        case DRAW_LIGHTS: draw_light_map(); break;
+        default: break;
+    }
+}
+#endif
+
+
+#if (LCD_BAND_RENDERING)
+/**
+ * @brief Replay the draw list onto each band holding changed tiles, and
+ * send the bands to the display.
+ * 
+ * @param handle SPI device handle of the display.
+ * @param changed_tiles Tile masks, one per column of tiles.
+ * @param last 1 if the bands are the last ones of the frame, else 0.
+ * 
+ * @note Each band only spans the rows of tiles between its top-most and
+ * bottom-most changed tiles.
+ * @note A band is drawn and sent in two parts when the scrolled columns of
+ * the display wrap around within it, so that each part is contiguous.
+ */
+static void render_bands(const spi_device_handle_t handle, const uint16_t *changed_tiles,
+                         const uint8_t last)
+{
+    const uint8_t num_bands = LCD_WIDTH / BAND_WIDTH;
+    const uint8_t tiles_per_band = BAND_WIDTH / TILE_SIZE;
+    uint16_t band_tiles[LCD_WIDTH / BAND_WIDTH] = {0};
+    uint8_t last_band = 0;
+    const uint8_t wrap = st7735s_get_scroll_wrap();
+    for (uint8_t tile_x = 0; tile_x < NUM_TILES_X; tile_x++) {
+        band_tiles[tile_x / tiles_per_band] |= changed_tiles[tile_x];
+        if (changed_tiles[tile_x]) {
+            last_band = tile_x / tiles_per_band;
+        }
+    }
+    for (uint8_t i = 0; i < num_bands; i++) {
+        if (!band_tiles[i]) {
+            continue;
+        }
+        uint8_t tile_y0 = 0, tile_y1 = NUM_TILES_Y - 1;
+        while (!((band_tiles[i] >> tile_y0) & 1)) {
+            tile_y0++;
+        }
+        while (!((band_tiles[i] >> tile_y1) & 1)) {
+            tile_y1--;
+        }
+        // Split the band where the scrolled columns wrap around, each part being sent whole
+        const uint8_t x_end = (i + 1) * BAND_WIDTH;
+        for (uint8_t x0 = i * BAND_WIDTH; x0 < x_end; x0 += band_window.width) {
+            band = st7735s_get_band();
+            band_window.pos_x = x0;
+            band_window.pos_y = tile_y0 * TILE_SIZE;
+            band_window.width = (x0 < wrap && wrap < x_end) ? wrap - x0 : x_end - x0;
+            band_window.height = (tile_y1 - tile_y0 + 1) * TILE_SIZE;
+            for (uint16_t j = 0; j < band_window.width * band_window.height; j++) {
+                band[j] = list_background;
+            }
+            COUNT_PIXELS(band_window.width * band_window.height);
+            for (uint16_t j = 0; j < draw_count; j++) {
+                replay_draw(&draw_list[j]);
+            }
+            const uint8_t last_part = (band_window.pos_x + band_window.width == x_end);
+            st7735s_send_band(handle, &band_window, last && (i == last_band) && last_part);
+        }
+    }
+}
+#endif
+
+
+#if (LCD_DEFERRED_RENDERING)
+/**
+ * @brief Compute the signature of each bin: a hash of the background color
+ * and of the drawings of the bin, in order.
+ * 
+ * @param[out] signatures Array of NUM_BINS signatures, never 0.
+ */
+static void get_signatures(uint32_t *signatures)
+{
+    for (uint8_t bin = 0; bin < NUM_BINS; bin++) {
+        uint32_t signature = hash_bytes(2166136261u, &list_background, sizeof(list_background));
+        for (uint8_t i = 0; i < bin_counts[bin]; i++) {
+            signature = hash_bytes(signature, &draw_list[bin_draws[bin][i]].hash, sizeof(uint32_t));
+        }
+        signatures[bin] = signature ? signature : 1;
+    }
+}
+
+
+/**
+ * @brief Add the area covered by a drawing with opaque pixels to the covered
+ * columns of each row of the band being drawn.
+ * 
+ * @param draw Drawing to add.
+ * @param rows Covered columns of each row of the band, as bit fields.
+ * @return 1 if the whole band is covered, else 0.
+ */
+static uint8_t cover_rows(const draw_t *draw, uint16_t *rows)
+{
+    const int16_t left = band_window.pos_x, top = band_window.pos_y;
+    const int16_t x0 = (draw->cover.x0 < left) ? left : draw->cover.x0;
+    const int16_t y0 = (draw->cover.y0 < top) ? top : draw->cover.y0;
+    const int16_t x1 = (left + BIN_SIZE - 1 < draw->cover.x1) ? left + BIN_SIZE - 1 : draw->cover.x1;
+    const int16_t y1 = (top + BIN_SIZE - 1 < draw->cover.y1) ? top + BIN_SIZE - 1 : draw->cover.y1;
+    if (x1 < x0 || y1 < y0) {
+        return 0;
+    }
+    const uint16_t mask = (uint16_t)((1UL << (x1 - left + 1)) - (1UL << (x0 - left)));
+    uint8_t covered = 1;
+    for (uint8_t y = 0; y < BIN_SIZE; y++) {
+        if (y0 <= top + y && top + y <= y1) {
+            rows[y] |= mask;
+        }
+        covered &= (rows[y] == (uint16_t)((1UL << BIN_SIZE) - 1));
+    }
+    return covered;
+}
+
+
+/**
+ * @brief Draw a bin onto the scratch tile, and copy it into the frame.
+ * 
+ * @param bin Index of the bin.
+ * 
+ * @note The drawings are replayed from the first one whose opaque pixels,
+ * with the ones of the drawings above it, cover the whole bin: the drawings
+ * under it would be hidden. The bin is only filled with the background color
+ * if the drawings do not cover it.
+ */
+static void draw_bin(const uint8_t bin)
+{
+    band = scratch_tile;
+    band_window.pos_x = (bin % NUM_BINS_X) * BIN_SIZE;
+    band_window.pos_y = (bin / NUM_BINS_X) * BIN_SIZE;
+    band_window.width = BIN_SIZE;
+    band_window.height = BIN_SIZE;
+    uint16_t rows[BIN_SIZE] = {0};
+    uint8_t first = bin_counts[bin];
+    while (0 < first && !cover_rows(&draw_list[bin_draws[bin][first - 1]], rows)) {
+        first--;
+    }
+    if (first == 0) {
+        for (uint16_t i = 0; i < BIN_SIZE * BIN_SIZE; i++) {
+            scratch_tile[i] = list_background;
+        }
+        COUNT_PIXELS(BIN_SIZE * BIN_SIZE);
+    }
+    else {
+        first--;
+    }
+    for (uint8_t i = first; i < bin_counts[bin]; i++) {
+        replay_draw(&draw_list[bin_draws[bin][i]]);
+    }
+    for (uint8_t y = 0; y < BIN_SIZE; y++) {
+        memcpy(&frame[(band_window.pos_y + y) * LCD_STRIDE + band_window.pos_x],
+               &scratch_tile[y * BIN_SIZE], BIN_SIZE * sizeof(uint16_t));
+    }
+}
+
+
+/**
+ * @brief Bring the back buffer up to date with the draw list, before it is
+ * presented. The bins it already holds are skipped, the bins held by the
+ * front buffer are copied from it, and the other bins are drawn.
+ * 
+ * @param signatures Signatures of the bins of the draw list.
+ */
+static void resolve_bins(const uint32_t *signatures)
+{
+    for (uint8_t bin = 0; bin < NUM_BINS; bin++) {
+        if (signatures[bin] == back_signatures[bin]) {
+            continue;
+        }
+        if (signatures[bin] == front_signatures[bin]) {
+            const window_t window = {
+                .pos_x = (bin % NUM_BINS_X) * BIN_SIZE,
+                .pos_y = (bin / NUM_BINS_X) * BIN_SIZE,
+                .width = BIN_SIZE,
+                .height = BIN_SIZE
+            };
+            st7735s_sync_frame(&window, 1);
+        }
+        else {
+            draw_bin(bin);
+        }
+    }
+    // The back buffer becomes the front buffer once presented, or stays the frame if single
+    const uint8_t single = (st7735s_get_num_frame_buffers() == 1);
+    for (uint8_t bin = 0; bin < NUM_BINS; bin++) {
+        back_signatures[bin] = single ? signatures[bin] : front_signatures[bin];
+        front_signatures[bin] = signatures[bin];
+    }
+}
+#endif
+
+
+void st7735s_fill_background(const uint16_t color)
+{
+    // The whole back buffer is overwritten, no need to bring it up to date
+    for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+        painted_tiles[i] = 0;
+        drawn_tiles[i] = 0;
+    }
+    filled = 1;
+    background_color = color;
+    static_drawn = 0;
+    if (static_reset) {
+        static_shown = 0;
+        static_reset = 0;
+    }
+#if (DRAW_LIST)
+    // Start a new draw list, each band being filled before the list is replayed
+    draw_count = 0;
+    list_background = color;
+#if (LCD_DEFERRED_RENDERING)
+    for (uint8_t bin = 0; bin < NUM_BINS; bin++) {
+        bin_counts[bin] = 0;
+    }
+#endif
+#else
+    stale = 0;
+    // The tiles are filled when drawn upon, or at the update of the display
+    for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+        unfilled_tiles[i] = (1 << NUM_TILES_Y) - 1;
+    }
+#if (LAYER_CACHE)
+    layer_filled = 0;
+#endif
+#endif
+}
+
+
+void st7735s_draw_rectangle(const rectangle_t *rectangle)
+{
+    if (rectangle == NULL) {
+        printf("Error(st7735s_draw_rectangle): rectangle_t pointer is NULL.\n");
+        assert(rectangle);
+    }
+    // An opaque rectangle covering the whole display is a solid fill
+    if (rectangle->alpha == 0 && rectangle->pos_x == 0 && rectangle->pos_y == 0 &&
+        LCD_WIDTH <= rectangle->width && LCD_HEIGHT <= rectangle->height && !static_layer) {
+        st7735s_fill_background(rectangle->color);
+        return;
+    }
+    const area_t area = {rectangle->pos_x, rectangle->pos_y, rectangle->pos_x + rectangle->width - 1,
+                         rectangle->pos_y + rectangle->height - 1};
+    if (rectangle->alpha == 0) {
+        cover_tiles(&area);
+    }
+    mark_wrapped_area(rectangle->pos_x, rectangle->pos_y, rectangle->width, rectangle->height);
+#if (DRAW_LIST)
+    draw_t draw = {.type = DRAW_RECTANGLE, .rectangle = *rectangle};
+    record_draw(&draw, area.x0, area.y0, area.x1, area.y1, (rectangle->alpha == 0) ? &area : NULL);
+#else
+    draw_rectangle(rectangle);
+#endif
+}
+
+
+void st7735s_draw_circle(const circle_t *circle)
+{
+    if (circle == NULL) {
+        printf("Error(st7735s_draw_circle): circle_t pointer is NULL.\n");
+        assert(circle);
+    }
+    mark_area(circle->pos_x - circle->radius, circle->pos_y - circle->radius,
+              circle->pos_x + circle->radius, circle->pos_y + circle->radius);
+#if (DRAW_LIST)
+    draw_t draw = {.type = DRAW_CIRCLE, .circle = *circle};
+    record_draw(&draw, circle->pos_x - circle->radius, circle->pos_y - circle->radius,
+                circle->pos_x + circle->radius, circle->pos_y + circle->radius, NULL);
+#else
+    draw_circle(circle);
+#endif
+}
+
+
+void st7735s_add_light(const light_t *light)
+{
+    if (light == NULL) {
+        printf("Error(st7735s_add_light): light_t pointer is NULL.\n");
+        assert(light);
+    }
+    if (MAX_LIGHTS <= num_lights) {
+        return;
+    }
+    lights[num_lights++] = *light;
+}
+
+
+void st7735s_draw_lights(void)
+{
+    // The light map is kept while the lights only move together
+    int16_t dx;
+    const uint8_t moved = is_light_map_moved(&dx);
+    memcpy(map_lights, lights, num_lights * sizeof(light_t));
+    map_num_lights = num_lights;
+    if (moved) {
+        light_dx += dx;
+    }
+    else {
+        compose_light_map();
+    }
+    num_lights = 0;
+    if (lit_y1 < lit_y0) {
+        return;
+    }
+    int16_t x0 = LCD_WIDTH, x1 = -1;
+    for (uint8_t i = 0; i < map_num_lights; i++) {
+        const light_t *light = &map_lights[i];
+        if (!light->radius || ALPHA_MAX <= light->alpha) {
+            continue;
+        }
+        mark_area(light->pos_x - light->radius, light->pos_y - light->radius,
+                  light->pos_x + light->radius, light->pos_y + light->radius);
+        x0 = (light->pos_x - light->radius < x0) ? light->pos_x - light->radius : x0;
+        x1 = (x1 < light->pos_x + light->radius) ? light->pos_x + light->radius : x1;
+    }
+#if (DRAW_LIST)
+    draw_t draw = {.type = DRAW_LIGHTS};
+    record_draw(&draw, x0, lit_y0, x1, lit_y1, NULL);
+#else
+    draw_light_map();
+#endif
+}
+
+
+void st7735s_draw_text(const text_t *text)
+{
+    if (text == NULL) {
+        printf("Error(st7735s_draw_text): text_t pointer is NULL.\n");
+        assert(text);
+    }
+    if (text->data == NULL) {
+        printf("Error(st7735s_draw_text): text data pointer is NULL.\n");
+        assert(text->data);
+    }
+    if (text->font == NULL) {
+        printf("Error(st7735s_draw_text): text font pointer is NULL.\n");
+        assert(text->font);
+    }
+    // Get the number of lines and the longest line to mark the text area
+    uint8_t num_lines = 1, num_chars = 0, max_chars = 0;
+    for (uint8_t char_index = 0; char_index < text->size && text->data[char_index] != '\0'; char_index++) {
+        if (text->data[char_index] == '\n') {
+            num_lines++;
+            num_chars = 0;
+        }
+        else if (max_chars < ++num_chars) {
+            max_chars = num_chars;
+        }
+    }
+    const uint8_t pos_x = text->pos_x - TEXT_PADDING_X;
+    const uint8_t pos_y = text->pos_y - TEXT_PADDING_Y;
+    const int16_t width = max_chars * (FONT_SIZE + TEXT_PADDING_X) + 2 * TEXT_PADDING_X;
+    const int16_t height = num_lines * (FONT_SIZE + TEXT_PADDING_Y) + 2 * TEXT_PADDING_Y;
+    mark_wrapped_area(pos_x, pos_y, width, height);
+#if (DRAW_LIST)
+    draw_t draw = {.type = DRAW_TEXT, .text = *text};
+    record_draw(&draw, pos_x, pos_y, pos_x + width - 1, pos_y + height - 1, NULL);
+#else
+    draw_text(text);
+#endif
+}
+
+
+void st7735s_draw_sprite(const sprite_t *sprite)
+{
+    if (sprite == NULL) {
+        printf("Error(st7735s_draw_sprite): sprite_t pointer is NULL.\n");
+        assert(sprite);
+    }
+    // Flipped or rotated sprites are drawn from their prebaked variant, if any
+    sprite_t straight;
+    sprite = get_straight_sprite(sprite, &straight);
+    if (sprite->indexed != NULL && sprite->indexed->bpp != 4 && sprite->indexed->bpp != 8) {
+        printf("Error(st7735s_draw_sprite): Indexed data of %u bits per pixel (4 or 8 expected).\n",
+               sprite->indexed->bpp);
+        assert(sprite->indexed->bpp == 4 || sprite->indexed->bpp == 8);
+    }
+    // Rotations swap the width and the height of the sprite
+    const uint8_t rotated = sprite->CW_90 || sprite->ACW_90;
+    const int16_t width = rotated ? sprite->height : sprite->width;
+    const int16_t height = rotated ? sprite->width : sprite->height;
+    // Area of the opaque pixels, and area drawn with opaque pixels only
+    area_t bounds = {sprite->pos_x, sprite->pos_y, sprite->pos_x + width - 1, sprite->pos_y + height - 1};
+    area_t cover = bounds;
+    if (!sprite->background_color && !sprite->opaque) {
+        const sprite_opacity_t *opacity = get_sprite_opacity(sprite);
+        if (opacity == NULL) {
+            cover = (area_t){0, 0, -1, -1};
+        }
+        else if (opacity->type == SPRITE_TRANSPARENT) {
+            return;
+        }
+        else {
+            get_sprite_area(sprite, &opacity->bounds, &bounds);
+            get_sprite_area(sprite, &opacity->opaque_box, &cover);
+        }
+    }
+    if (sprite->alpha == 0) {
+        cover_tiles(&cover);
+    }
+    mark_area(bounds.x0, bounds.y0, bounds.x1, bounds.y1);
+#if (DRAW_LIST)
+    draw_t draw = {.type = DRAW_SPRITE, .sprite = *sprite};
+    record_draw(&draw, bounds.x0, bounds.y0, bounds.x1, bounds.y1, (sprite->alpha == 0) ? &cover : NULL);
+#else
+    draw_sprite(sprite);
+#endif
+}
+
+
+void st7735s_draw_widget(hud_widget_t *widget, const uint16_t value)
+{
+    if (widget == NULL) {
+        printf("Error(st7735s_draw_widget): hud_widget_t pointer is NULL.\n");
+        assert(widget);
+    }
+    if (widget->text.font == NULL) {
+        printf("Error(st7735s_draw_widget): text font pointer is NULL.\n");
+        assert(widget->text.font);
+    }
+    // Characters of the widget: its label, or the digits of its value, kept
+    // in the widget as the drawing may be replayed from the draw list
+    char *chars = widget->chars;
+    uint8_t num_chars = 0;
+    if (widget->num_digits) {
+        if (HUD_MAX_CHARS < widget->num_digits) {
+            printf("Error(st7735s_draw_widget): more than HUD_MAX_CHARS digits.\n");
+            assert(0);
+        }
+        uint16_t remainder = value;
+        do {
+            num_chars++;
+            remainder /= 10;
+        } while (remainder && num_chars < widget->num_digits);
+        remainder = value;
+        for (uint8_t i = num_chars; 0 < i; i--) {
+            chars[i - 1] = '0' + remainder % 10;
+            remainder /= 10;
+        }
+        chars[num_chars] = '\0';
+    }
+    else {
+        if (widget->text.data == NULL) {
+            printf("Error(st7735s_draw_widget): text data pointer is NULL.\n");
+            assert(widget->text.data);
+        }
+        while (num_chars < widget->text.size && widget->text.data[num_chars] != '\0' &&
+               widget->text.data[num_chars] != '\n') {
+            num_chars++;
+        }
+        if (HUD_MAX_CHARS < num_chars) {
+            printf("Error(st7735s_draw_widget): label longer than HUD_MAX_CHARS.\n");
+            assert(0);
+        }
+        memcpy(chars, widget->text.data, num_chars);
+        chars[num_chars] = '\0';
+    }
+    // The glyph rows are drawn one pixel below the text position
+    const int16_t x0 = widget->text.pos_x;
+    const int16_t y0 = widget->text.pos_y + 1;
+    const int16_t x1 = x0 + num_chars * (FONT_SIZE + TEXT_PADDING_X) - TEXT_PADDING_X - 1;
+    const int16_t y1 = y0 + FONT_SIZE - 1;
+    if (!num_chars || widget->text.background || !is_area_background(x0, y0, x1, y1)) {
+        // Other objects lie under the widget, or it has its own background:
+        // draw it as a text
+        text_t text = widget->text;
+        if (widget->num_digits) {
+            text.data = chars;
+            text.size = sizeof(widget->chars);
+        }
+        st7735s_draw_text(&text);
+        return;
+    }
+    if (!widget->rendered || widget->background != background_color ||
+        (widget->num_digits && widget->value != value)) {
+        if (!text_tables) {
+            init_text_tables();
+        }
+        uint16_t color = widget->text.color;
+        if (widget->text.adaptive) {
+            adapt_color(SPI_SWAP_DATA_TX(background_color, 16), &color);
+            color = SPI_SWAP_DATA_TX(color, 16);
+        }
+        widget->background = background_color;
+        widget->value = value;
+        render_widget(widget, chars, num_chars, color);
+        widget->rendered = 1;
+    }
+    const sprite_t sprite = {
+        .opaque = 1,
+        .width = widget->width,
+        .height = FONT_SIZE,
+        .pos_x = x0,
+        .pos_y = y0,
+        .alpha = widget->text.alpha,
+        .data = widget->pixels
+    };
+    st7735s_draw_sprite(&sprite);
+}
+
+
+void st7735s_set_static_layer(const uint8_t enable)
+{
+    static_layer = enable;
+}
+
+
+void st7735s_invalidate_static_layer(void)
+{
+    static_reset = 1;
+#if (LAYER_CACHE)
+    layer_valid = 0;
+#endif
+}
+
+
+#if (LAYER_CACHE)
+/**
+ * @brief Clear columns of the cached static layer to its background color.
+ * 
+ * @param x0 Left-most column, within the display.
+ * @param x1 Right-most column, within the display.
+ */
+static void clear_layer(const int16_t x0, const int16_t x1)
+{
+    for (int16_t y = 0; y < LCD_HEIGHT; y++) {
+        uint16_t *pixels = &layer[y * LCD_WIDTH];
+        for (int16_t x = x0; x <= x1; x++) {
+            pixels[x] = layer_background;
+        }
+    }
+    for (int16_t x = x0; x <= x1; x++) {
+        layer_columns[x] = 0;
+    }
+    COUNT_PIXELS((x1 - x0 + 1) * LCD_HEIGHT);
+}
+
+
+/**
+ * @brief Move the cached static layer to the left along with the frame.
+ * 
+ * @param dx Number of pixels by which the layer moves to the left, less
+ * than LCD_WIDTH.
+ * @param[out] x0 Left-most column exposed.
+ * @param[out] x1 Right-most column exposed.
+ */
+static void shift_layer(const int16_t dx, int16_t *x0, int16_t *x1)
+{
+    const int16_t kept = LCD_WIDTH - abs(dx);
+    const int16_t src = (0 < dx) ? dx : 0;
+    const int16_t dst = (0 < dx) ? 0 : -dx;
+    // The rows of tiles where nothing was drawn hold the background only
+    uint16_t rows = 0;
+    for (int16_t x = 0; x < LCD_WIDTH; x++) {
+        rows |= layer_columns[x];
+    }
+    for (int16_t y = 0; y < LCD_HEIGHT; y++) {
+        if ((rows >> (y / TILE_SIZE)) & 1) {
+            memmove(&layer[y * LCD_WIDTH + dst], &layer[y * LCD_WIDTH + src], kept * sizeof(uint16_t));
+            COUNT_PIXELS(kept);
+        }
+    }
+    memmove(&layer_columns[dst], &layer_columns[src], kept * sizeof(uint16_t));
+    *x0 = (0 < dx) ? kept : 0;
+    *x1 = (0 < dx) ? LCD_WIDTH - 1 : -dx - 1;
+}
+#endif
+
+
+uint8_t st7735s_begin_layer(int16_t *x0, int16_t *x1)
+{
+    if (x0 == NULL || x1 == NULL) {
+        printf("Error(st7735s_begin_layer): Column pointer is NULL.\n");
+        assert(x0 && x1);
+    }
+    static_layer = 1;
+#if (LAYER_CACHE)
+    // Allocated once the rest of the console (e.g. the BLE host) took its share of the heap
+    if (!layer_allocated) {
+        layer_allocated = 1;
+        layer = heap_caps_calloc(LCD_NPIX, sizeof(uint16_t), MALLOC_CAP_8BIT);
+        if (layer == NULL) {
+            printf("Warning(st7735s_begin_layer): No memory left for the layer cache, the static layer is drawn at each frame.\n");
+        }
+    }
+    const int16_t dx = layer_dx;
+    layer_dx = 0;
+    if (layer == NULL) {
+        *x0 = 0;
+        *x1 = LCD_WIDTH - 1;
+        return 1;
+    }
+    if (!layer_valid || layer_background != background_color || LCD_WIDTH <= abs(dx)) {
+        layer_background = background_color;
+        layer_valid = 1;
+        *x0 = 0;
+        *x1 = LCD_WIDTH - 1;
+    }
+    else if (dx) {
+        shift_layer(dx, x0, x1);
+    }
+    else {
+        *x0 = LCD_WIDTH;
+        *x1 = -1;
+    }
+    // The invalidated columns are drawn along with the exposed ones
+    if (invalid_x0 <= invalid_x1) {
+        *x0 = (invalid_x0 < *x0) ? invalid_x0 : *x0;
+        *x1 = (*x1 < invalid_x1) ? invalid_x1 : *x1;
+        invalid_x0 = LCD_WIDTH;
+        invalid_x1 = -1;
+    }
+    if (*x1 < *x0) {
+        return 0;
+    }
+    clear_layer(*x0, *x1);
+    layer_x0 = *x0;
+    layer_x1 = *x1;
+    layer_drawing = 1;
+#else
+    *x0 = 0;
+    *x1 = LCD_WIDTH - 1;
+#endif
+    return 1;
+}
+
+
+void st7735s_end_layer(void)
+{
+    static_layer = 0;
+#if (LAYER_CACHE)
+    if (layer == NULL) {
+        return;
+    }
+    layer_drawing = 0;
+    layer_filled = 1;
+    static_drawn = 1;
+    // The tiles holding drawings of the layer are not background
+    for (uint8_t tile_x = 0; tile_x < NUM_TILES_X; tile_x++) {
+        uint16_t mask = 0;
+        for (uint8_t x = 0; x < TILE_SIZE; x++) {
+            mask |= layer_columns[tile_x * TILE_SIZE + x];
+        }
+        drawn_tiles[tile_x] |= mask;
+        if (!static_shown) {
+            painted_tiles[tile_x] |= mask;
+        }
+    }
+#endif
+}
+
+
+void st7735s_invalidate_layer(const int16_t pos_x, const int16_t pos_y,
+                              const uint8_t width, const uint8_t height)
+{
+    int16_t x0 = pos_x, y0 = pos_y, x1 = pos_x + width - 1, y1 = pos_y + height - 1;
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    x1 = (LCD_WIDTH <= x1) ? LCD_WIDTH - 1 : x1;
+    y1 = (LCD_HEIGHT <= y1) ? LCD_HEIGHT - 1 : y1;
+    if (x1 < x0 || y1 < y0) {
+        return;
+    }
+    // Sent once, as the static layer is not sent where it is displayed
+    const uint16_t mask = (uint16_t)((1 << (y1 / TILE_SIZE + 1)) - (1 << (y0 / TILE_SIZE)));
+    for (uint8_t tile_x = x0 / TILE_SIZE; tile_x <= x1 / TILE_SIZE; tile_x++) {
+        invalid_tiles[tile_x] |= mask;
+    }
+#if (LAYER_CACHE)
+    invalid_x0 = (x0 < invalid_x0) ? x0 : invalid_x0;
+    invalid_x1 = (invalid_x1 < x1) ? x1 : invalid_x1;
+#endif
+}
+
+
+void st7735s_scroll_frame(const int16_t dx)
+{
+    scroll_dx += dx;
+#if (LAYER_CACHE)
+    layer_dx += dx;
+#endif
+}
+
+
+void st7735s_invalidate_area(const int16_t pos_x, const int16_t pos_y,
+                             const uint8_t width, const uint8_t height)
+{
+    const uint8_t was_static = static_layer;
+    static_layer = 0;
+    mark_area(pos_x, pos_y, pos_x + width - 1, pos_y + height - 1);
+    static_layer = was_static;
+}
+
+
+void st7735s_update_display(const spi_device_handle_t handle)
+{
+    uint16_t changed_tiles[NUM_TILES_X];
+    uint16_t uniform_tiles[NUM_TILES_X] = {0};
+    uint8_t full_update = 0;
+    const int16_t dx = scroll_dx;
+    scroll_dx = 0;
+#if !(DRAW_LIST)
+    // The frame is complete: fill the tiles left to the background
+    fill_tiles(0, NUM_TILES_X - 1, (1 << NUM_TILES_Y) - 1);
+#endif
+#if (LCD_PROFILING)
+    if (++drawn_frames == LCD_PROFILING_FRAMES) {
+        printf("LCD(profiling): overdraw %lu.%02lu (%lu pixels/frame)\n",
+               (unsigned long)(drawn_pixels / drawn_frames / LCD_NPIX),
+               (unsigned long)(drawn_pixels / drawn_frames % LCD_NPIX * 100 / LCD_NPIX),
+               (unsigned long)(drawn_pixels / drawn_frames));
+        drawn_pixels = 0;
+        drawn_frames = 0;
+    }
+#endif
+    // Present at the pace of the display, even if nothing changed
+    st7735s_wait_refresh();
+    if (filled) {
+        // Compare against what is displayed: the background, and what was drawn on it
+        full_update = !shown_filled || shown_background != background_color;
+        if (dx && !full_update) {
+            // What was drawn on the background moved along with the scroll
+            full_update = (LCD_WIDTH / 2 <= abs(dx));
+            shift_tiles(shown_tiles, dx);
+        }
+        for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+            changed_tiles[i] = painted_tiles[i] | shown_tiles[i];
+            shown_tiles[i] = painted_tiles[i];
+        }
+        shown_filled = 1;
+        shown_background = background_color;
+    }
+    else {
+        // The frame was drawn on top of the displayed frame
+        full_update = (dx != 0);
+        for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+            changed_tiles[i] = painted_tiles[i];
+            shown_tiles[i] |= painted_tiles[i];
+        }
+    }
+    static_shown = static_drawn;
+    static_drawn = 0;
+    for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+        painted_tiles[i] = 0;
+        changed_tiles[i] |= invalid_tiles[i];
+        invalid_tiles[i] = 0;
+        if (full_update) {
+            changed_tiles[i] = (1 << NUM_TILES_Y) - 1;
+        }
+    }
+    // The columns exposed by the scroll are sent entirely
+    if (dx) {
+        const int16_t x0 = (0 < dx) ? LCD_WIDTH - dx : 0;
+        const int16_t x1 = (0 < dx) ? LCD_WIDTH - 1 : -dx - 1;
+        for (uint8_t tile_x = x0 / TILE_SIZE; tile_x <= x1 / TILE_SIZE && tile_x < NUM_TILES_X; tile_x++) {
+            changed_tiles[tile_x] = (1 << NUM_TILES_Y) - 1;
+        }
+    }
+#if (LCD_DEFERRED_RENDERING)
+    // The bins whose drawings did not change are left as they are displayed
+    uint32_t signatures[NUM_BINS];
+    get_signatures(signatures);
+    if (!dx) {
+        const uint8_t tiles_per_bin = BIN_SIZE / TILE_SIZE;
+        const uint16_t bin_mask = (1 << tiles_per_bin) - 1;
+        for (uint8_t bin = 0; bin < NUM_BINS; bin++) {
+            if (signatures[bin] != front_signatures[bin]) {
+                continue;
+            }
+            const uint8_t tile_x = (bin % NUM_BINS_X) * tiles_per_bin;
+            for (uint8_t i = 0; i < tiles_per_bin; i++) {
+                changed_tiles[tile_x + i] &= ~(bin_mask << ((bin / NUM_BINS_X) * tiles_per_bin));
+            }
+        }
+    }
+#endif
+    // The changed tiles where nothing was drawn hold the background only
+    if (filled) {
+        for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+            uniform_tiles[i] = changed_tiles[i] & ~drawn_tiles[i];
+        }
+    }
+    filled = 0;
+    window_t uniform_windows[MAX_WINDOWS];
+    uint8_t num_uniform_windows;
+    get_windows(uniform_tiles, uniform_windows, &num_uniform_windows);
+    if (MAX_WINDOWS < num_uniform_windows) {
+        // Too scattered to be filled: send them along with the other tiles
+        num_uniform_windows = 0;
+    }
+    else {
+        for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+            changed_tiles[i] &= ~uniform_tiles[i];
+        }
+    }
+    // A full update sends every tile, the display does not need to be scrolled
+    const uint8_t scrolled = dx && !full_update;
+
+#if (LCD_BAND_RENDERING)
+    uint8_t changed = 0;
+    for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+        changed |= (changed_tiles[i] != 0);
+    }
+    if (!changed && !num_uniform_windows) {
+        return;
+    }
+    if (scrolled) {
+        st7735s_scroll_display(handle, dx);
+    }
+    if (changed) {
+        render_bands(handle, changed_tiles, !num_uniform_windows);
+    }
+    st7735s_fill_windows(handle, uniform_windows, num_uniform_windows, background_color, 1);
+#else
+    window_t windows[MAX_WINDOWS];
+    uint8_t num_windows;
+    const uint16_t num_tiles = get_windows(changed_tiles, windows, &num_windows);
+    if (!num_tiles && !num_uniform_windows) {
+        // Nothing changed: keep both the display and the frame buffers as they are
+        return;
+    }
+#if (LCD_DEFERRED_RENDERING)
+    resolve_bins(signatures);
+#endif
+    if (MAX_WINDOWS < num_windows ||
+        NUM_TILES_X * NUM_TILES_Y * MAX_WINDOWS_AREA < num_tiles * 100 ||
+        (full_update && !num_uniform_windows)) {
+        st7735s_present_frame(handle);
+    }
+    else {
+        if (scrolled) {
+            st7735s_scroll_display(handle, dx);
+        }
+        st7735s_present_windows(handle, windows, num_windows);
+        st7735s_fill_windows(handle, uniform_windows, num_uniform_windows, background_color, 1);
+    }
+#if !(LCD_DEFERRED_RENDERING)
+    // The new back buffer holds the previous frame, which was not scrolled
+    for (uint8_t i = 0; i < NUM_TILES_X; i++) {
+        stale_tiles[i] = dx ? (1 << NUM_TILES_Y) - 1 : changed_tiles[i] | uniform_tiles[i];
+    }
+    stale = 1;
+#endif
+#endif
+}
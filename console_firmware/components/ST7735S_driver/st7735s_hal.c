@@ -1,76 +1,618 @@
 #include "include/st7735s_hal.h"
 
-uint16_t frame[NUM_TRANSACTIONS][PX_PER_TRANSACTION] = {0};
+#if (LCD_BAND_RENDERING)
+// Ping-pong buffers holding the bands, one being drawn while the other is sent
+static DMA_ATTR uint16_t band_buffers[2][BAND_WIDTH * LCD_HEIGHT] = {0};
+static uint8_t band_index = 0;          // Band buffer being drawn
+static uint8_t band_count = 0;          // Number of bands and fills sent for the current frame
+#else
+// The second frame buffer is allocated from the heap by st7735s_wait_tft()
+static DMA_ATTR uint16_t frame_buffer[LCD_NPIX] = {0};
+static uint16_t *frame_buffers[NUM_FRAME_BUFFERS] = {frame_buffer};
+static uint8_t num_frame_buffers = 1;
+uint16_t *frame = frame_buffer;
+static uint8_t back_buffer = 0;
+
+// Ping-pong buffers used to gather the pixels of windows (partial updates)
+static DMA_ATTR uint8_t staging_buffers[2][LCD_STAGING_BYTES];
+static uint8_t staging_busy[2] = {0};   // 1 if the staging buffer is being sent
+static uint8_t staging_index = 0;       // Staging buffer being filled
+static uint16_t staged_bytes = 0;       // Number of bytes in the staging buffer being filled
+static uint8_t half_pair = 0;           // 1 if a RGB444 pixel waits for the second pixel of its pair
+static uint16_t half_pair_pixel = 0;    // RGB444 pixel waiting for the second pixel of its pair
+#endif
+
+// Buffer repeating the color of the solid fills, in the format of the interface
+static DMA_ATTR uint8_t fill_buffer[LCD_FILL_BYTES];
+static uint16_t fill_color = 0;
+static uint8_t fill_format = 0;         // Format of the fill buffer, 0 if not filled yet
+
+/* Ring of the transactions queued to the SPI device (commands and pixels).
+ They must remain valid until their result is retrieved.*/
+static spi_transaction_t transactions[SPI_LCD_QSIZE];
+static uint16_t first_transaction = 0;  // Oldest queued transaction of the ring
+static uint16_t queued_transactions = 0;
+static uint8_t scroll = 0;              // Scroll of the display along the x-axis, in pixels
+static uint8_t color_format = LCD_COLOR_FORMAT; // Pixel format in which the frame is sent
+static SemaphoreHandle_t tft_ready = NULL;      // Given once the display is initialized
+static SemaphoreHandle_t refresh_ready = NULL;  // Given at each refresh of the display, once paced
+#if (LCD_TE_WIRED)
+// PIN_LCD_TE is an enum, which the preprocessor cannot check
+_Static_assert(!LCD_TE_WIRED || PIN_LCD_TE >= 0, "LCD_TE_WIRED needs PIN_LCD_TE");
+static uint8_t te_divider = 0;                  // Number of TE pulses per refresh, 0 until the TE interrupt is set up
+static uint8_t te_pulses = 0;                   // TE pulses since the last refresh
+#else
+static esp_timer_handle_t refresh_timer = NULL; // Paces the refreshes, as the TE pin is not wired
+#endif
+
+/**
+ * @brief Commands sent to initialize the ST7735S chip, after its hardware
+ * reset.
+ */
+static const lcd_command_t init_commands[] = {
+    // Reset software
+    {.command = SWRESET, .delay = 120},
+    // Sleep out
+    {.command = SLPOUT, .delay = 250},
+    // Pixel format
+    {.command = COLMOD, .num_parameters = 1, .parameters = {LCD_COLOR_FORMAT}},
+    // Frame rate control
+    {.command = FRMCTR1, .num_parameters = 3, .parameters = {LCD_RTNA, LCD_FPA, LCD_BPA}},
+    // Memory data access control
+    {.command = MADCTL, .num_parameters = 1, .parameters = {
+        (LCD_MY << 7) | (LCD_MX << 6) | (LCD_MV << 5) |
+        (LCD_ML << 4) | (LCD_RGB << 3) | (LCD_MH << 2)}},
+    // Display inversion off
+    {.command = INVOFF},
+    // Power control 1 - Default applied
+    {.command = PWCTR1, .num_parameters = 3, .parameters = {0xA8, 0x08, 0x84}},
+    // Power control 2 - Default applied
+    {.command = PWCTR2, .num_parameters = 1, .parameters = {0xC0}},
+    // VCOM control - Default applied
+    {.command = VMCTR1, .num_parameters = 1, .parameters = {0x05}},
+    // Display function control
+    {.command = INVCTR, .num_parameters = 1, .parameters = {0x00}},
+    // Gamma curve
+    {.command = GAMSET, .num_parameters = 1, .parameters = {LCD_GAMMA}},
+    // Scroll over all the rows, without fixed areas
+    {.command = SCRLAR, .num_parameters = 6, .parameters = {0x00, 0x00, 0x00, LCD_WIDTH, 0x00, 0x00}},
+    // Normal display mode ON
+    {.command = NORON},
+    // Switch display on
+    {.command = DISPON},
+    // Set all columns
+    {.command = CASET, .num_parameters = 4, .parameters = {0x00, 0x00, 0x00, LCD_WIDTH - 1}},
+    // Set all rows
+    {.command = RASET, .num_parameters = 4, .parameters = {0x00, 0x00, 0x00, LCD_HEIGHT - 1}}
+};
+
+#if (LCD_PROFILING)
+static volatile int64_t transfer_end = 0;   // Time at which the last transaction ended, in us
+static int64_t transfer_start = 0;          // Time at which the frame was queued, in us
+static int64_t transfer_time = 0;           // Accumulated transfer time, in us
+static int64_t blocked_time = 0;            // Accumulated time spent waiting for a transfer, in us
+static uint32_t transfer_bytes = 0;         // Accumulated amount of pixel data sent, in bytes
+static uint16_t profiled_frames = 0;
+
+
+/**
+ * @brief SPI post-transaction callback, recording the end time of the last
+ * transaction of a frame.
+ * 
+ * @param[in] transaction Transaction that has just been sent.
+ */
+static void IRAM_ATTR lcd_post_transaction(spi_transaction_t *transaction)
+{
+    if ((uintptr_t)transaction->user & LCD_TRANS_LAST) {
+        transfer_end = esp_timer_get_time();
+    }
+}
+#endif
+
+
+/**
+ * @brief SPI pre-transaction callback, setting the D/C line for the
+ * transaction: low for a command, high for data.
+ * 
+ * @param[in] transaction Transaction about to be sent.
+ */
+static void IRAM_ATTR lcd_pre_transaction(spi_transaction_t *transaction)
+{
+    gpio_set_level(PIN_LCD_DC, ((uintptr_t)transaction->user & LCD_TRANS_DATA) ? 1 : 0);
+}
+
+
+#if (LCD_TE_WIRED)
+/**
+ * @brief GPIO interrupt of the TE pin, giving a refresh every te_divider
+ * pulses.
+ * 
+ * @param[in] arg Unused.
+ */
+static void IRAM_ATTR lcd_te_isr(void *arg)
+{
+    if (++te_pulses < te_divider) {
+        return;
+    }
+    te_pulses = 0;
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(refresh_ready, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+#else
+/**
+ * @brief Timer callback giving a refresh, if the TE pin is not wired.
+ * 
+ * @param[in] arg Unused.
+ */
+static void lcd_refresh_timer(void *arg)
+{
+    xSemaphoreGive(refresh_ready);
+}
+#endif
+
+
+/**
+ * @brief Retrieve the result of the oldest queued transaction, waiting
+ * for it to complete if necessary.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ */
+static void retrieve_transaction(const spi_device_handle_t handle)
+{
+    spi_transaction_t *transaction;
+    ESP_ERROR_CHECK(spi_device_get_trans_result(handle, &transaction, portMAX_DELAY));
+    first_transaction = (first_transaction + 1) % SPI_LCD_QSIZE;
+    queued_transactions--;
+#if !(LCD_BAND_RENDERING)
+    for (uint8_t i = 0; i < 2; i++) {
+        if (transaction->tx_buffer == staging_buffers[i]) {
+            staging_busy[i] = 0;
+        }
+    }
+#endif
+}
+
+
+/**
+ * @brief Retrieve the results of all the queued transactions, waiting for
+ * them to complete.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ */
+static void wait_transactions(const spi_device_handle_t handle)
+{
+    while (queued_transactions) {
+        retrieve_transaction(handle);
+    }
+}
+
+
+/**
+ * @brief Get the next free transaction of the ring, retrieving the oldest
+ * queued transaction if the ring is full.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] flags LCD_TRANS_DATA for data, LCD_TRANS_LAST for the last
+ * transaction of a frame, 0 for a command.
+ * @return Pointer to the cleared transaction, to be queued before getting
+ * the next one.
+ */
+static spi_transaction_t *get_transaction(const spi_device_handle_t handle, const uint8_t flags)
+{
+    if (SPI_LCD_QSIZE <= queued_transactions) {
+        retrieve_transaction(handle);
+    }
+    spi_transaction_t *transaction = &transactions[(first_transaction + queued_transactions) % SPI_LCD_QSIZE];
+    memset(transaction, 0, sizeof(*transaction));
+    transaction->user = (void *)(uintptr_t)flags;
+    return transaction;
+}
+
+
+/**
+ * @brief Queue a transaction obtained with get_transaction().
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] transaction Transaction to queue.
+ */
+static void queue_transaction(const spi_device_handle_t handle, spi_transaction_t *transaction)
+{
+    ESP_ERROR_CHECK(spi_device_queue_trans(handle, transaction, portMAX_DELAY));
+    queued_transactions++;
+}
 
 
 /**
- * @brief Send a command to the ST7735S chip.
+ * @brief Queue a command and its parameters to be sent to the ST7735S chip.
  * 
  * @param[in] handle SPI device handle of the display.
  * @param[in] command 8-bit command (see ST7735S datasheet p.104)
+ * @param[in] parameters Pointer to the parameters of the command.
+ * @param[in] num_parameters Number of parameters, in byte.
+ * 
+ * @warning Up to 4 parameters are copied into the transaction. Beyond, they
+ * must remain valid until the transaction is complete.
  */
-static void send_command(const spi_device_handle_t handle, uint8_t const command)
+static void queue_command(const spi_device_handle_t handle, const uint8_t command,
+                          const uint8_t *parameters, const uint8_t num_parameters)
 {
-    spi_transaction_t transaction;
-    memset(&transaction, 0, sizeof(transaction));
-    transaction.length = 8;
-    transaction.tx_buffer = &command;
-    
-    ESP_ERROR_CHECK(gpio_set_level(PIN_LCD_DC, 0)); // Enable command mode
-    ESP_ERROR_CHECK(spi_device_polling_transmit(handle, &transaction));
+    spi_transaction_t *transaction = get_transaction(handle, 0);
+    transaction->flags = SPI_TRANS_USE_TXDATA;
+    transaction->length = 8;
+    transaction->tx_data[0] = command;
+    queue_transaction(handle, transaction);
+    if (!num_parameters) {
+        return;
+    }
+    transaction = get_transaction(handle, LCD_TRANS_DATA);
+    transaction->length = 8 * num_parameters;
+    if (num_parameters <= sizeof(transaction->tx_data)) {
+        transaction->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(transaction->tx_data, parameters, num_parameters);
+    }
+    else {
+        transaction->tx_buffer = parameters;
+    }
+    queue_transaction(handle, transaction);
 }
 
 
 /**
- * @brief Send a packet of 8-bit data to the ST7735S chip.
+ * @brief Set the column and row address ranges in which the next pixels
+ * will be written.
  * 
  * @param[in] handle SPI device handle of the display.
- * @param[in] data Pointer to the 8-bit data to be sent.
- * @param[in] len Amount of data in byte.
+ * @param[in] window Area of the display to write into.
  * 
- * @note This function is useful to send command arguments to the ST7735S
- * driver, or 8-bit color format data. It is recommended to make use of the
- * send_words() function if sending 16-bit color format data.
+ * @note The rows and columns are exchanged (see LCD_MV): the columns of the
+ * ST7735S are the x-axis of the display, and its rows are the y-axis. The
+ * pixels are written row by row.
+ * @note The columns are offset by the scroll of the display. The window must
+ * not wrap around the last column.
  */
-static void send_bytes(const spi_device_handle_t handle, const uint8_t *data,
-                       const uint16_t len)
+static void set_window(const spi_device_handle_t handle, const window_t *window)
 {
-    spi_transaction_t transaction;
-    memset(&transaction, 0, sizeof(transaction));
-    transaction.length = 8 * len;
-    transaction.tx_buffer = (void *)data;
-    
-    gpio_set_level(PIN_LCD_DC, 1); // Enable data mode
-    ESP_ERROR_CHECK(spi_device_polling_transmit(handle, &transaction));
+    const uint8_t column = (window->pos_x + scroll) % LCD_WIDTH;
+    const uint8_t columns[4] = {0x00, column, 0x00, column + window->width - 1};
+    queue_command(handle, CASET, columns, sizeof(columns));
+
+    const uint8_t rows[4] = {0x00, window->pos_y, 0x00, window->pos_y + window->height - 1};
+    queue_command(handle, RASET, rows, sizeof(rows));
 }
 
 
 /**
- * @brief Send a packet of 16-bit data to the ST7735S chip.
+ * @brief Queue contiguous pixel data to be sent to the ST7735S chip, split
+ * into transactions of at most MAX_TRANSFER_SIZE bytes.
  * 
  * @param[in] handle SPI device handle of the display.
- * @param[in] data Pointer to the 16-bit data to be sent.
+ * @param[in] data Pointer to the first byte to send.
  * @param[in] len Amount of data in byte.
+ * @param[in] last 1 if the data is the last one of the frame, else 0.
+ * 
+ * @warning The data must remain valid until the transactions are complete.
+ */
+static void queue_data(const spi_device_handle_t handle, const uint8_t *data,
+                       uint32_t len, const uint8_t last)
+{
+#if (LCD_PROFILING)
+    transfer_bytes += len;
+#endif
+    while (len) {
+        const uint16_t length = (len < MAX_TRANSFER_SIZE) ? len : MAX_TRANSFER_SIZE;
+        len -= length;
+        spi_transaction_t *transaction = get_transaction(handle, LCD_TRANS_DATA |
+                                                         ((last && !len) ? LCD_TRANS_LAST : 0));
+        transaction->tx_buffer = data;
+        transaction->length = 8 * length;
+        queue_transaction(handle, transaction);
+        data += length;
+    }
+}
+
+
+/**
+ * @brief Convert a pixel of the frame to the 12-bit color format.
+ * 
+ * @param[in] pixel Pixel of the frame (RGB565, byte-swapped for SPI).
+ * @return Pixel in RGB444 format, on the 12 lower bits.
+ */
+static inline uint16_t get_rgb444(const uint16_t pixel)
+{
+    const uint16_t color = SPI_SWAP_DATA_TX(pixel, 16);
+    return ((color >> 4) & 0xF00) | ((color >> 3) & 0x0F0) | ((color >> 1) & 0x00F);
+}
+
+
+#if (LCD_BAND_RENDERING)
+/**
+ * @brief Pack pixels into the 12-bit color format, 2 pixels in 3 bytes.
+ * 
+ * @param[out] data Pointer to the packed data. It may be the address of the
+ * pixels themselves, the data being packed in place.
+ * @param[in] pixels Pointer to the first pixel to pack.
+ * @param[in] num_pixels Number of pixels to pack.
+ * @return Amount of packed data in byte.
+ * 
+ * @note If the number of pixels is odd, the last pixel is padded with 4
+ * bits that the ST7735S chip ignores.
+ */
+static uint32_t pack_pixels(uint8_t *data, const uint16_t *pixels, const uint32_t num_pixels)
+{
+    uint8_t *start = data;
+    uint32_t i = 0;
+    for (; i + 1 < num_pixels; i += 2) {
+        // Both pixels are read before their bytes are written
+        const uint16_t first = get_rgb444(pixels[i]);
+        const uint16_t second = get_rgb444(pixels[i + 1]);
+        *data++ = first >> 4;
+        *data++ = (first << 4) | (second >> 8);
+        *data++ = second;
+    }
+    if (i < num_pixels) {
+        const uint16_t first = get_rgb444(pixels[i]);
+        *data++ = first >> 4;
+        *data++ = first << 4;
+    }
+    return data - start;
+}
+#endif
+
+
+#if !(LCD_BAND_RENDERING)
+/**
+ * @brief Queue the staging buffer being filled, and switch to the other
+ * staging buffer.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] last 1 if the staged pixels are the last ones of the frame, else 0.
+ */
+static void flush_staging(const spi_device_handle_t handle, const uint8_t last)
+{
+    if (!staged_bytes) {
+        return;
+    }
+    spi_transaction_t *transaction = get_transaction(handle, LCD_TRANS_DATA |
+                                                     (last ? LCD_TRANS_LAST : 0));
+    transaction->tx_buffer = staging_buffers[staging_index];
+    transaction->length = 8 * staged_bytes;
+    queue_transaction(handle, transaction);
+#if (LCD_PROFILING)
+    transfer_bytes += staged_bytes;
+#endif
+    staging_busy[staging_index] = 1;
+    staged_bytes = 0;
+    // Wait for the other staging buffer to be free before filling it
+    staging_index = !staging_index;
+    while (staging_busy[staging_index]) {
+        retrieve_transaction(handle);
+    }
+}
+
+
+/**
+ * @brief Copy pixels into the staging buffers, queueing each buffer as soon
+ * as it is full.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] pixels Pointer to the first pixel to copy.
+ * @param[in] num_pixels Number of pixels to copy.
+ * 
+ * @note In 12-bit color format, the pixels are packed by pairs of 3 bytes.
+ * A pixel left without pair waits for the next call.
+ */
+static void stage_pixels(const spi_device_handle_t handle, const uint16_t *pixels,
+                         uint16_t num_pixels)
+{
+    if (color_format == LCD_COLOR_FORMAT_12) {
+        for (uint16_t i = 0; i < num_pixels; i++) {
+            const uint16_t pixel = get_rgb444(pixels[i]);
+            if (!half_pair) {
+                half_pair_pixel = pixel;
+                half_pair = 1;
+                continue;
+            }
+            uint8_t *data = &staging_buffers[staging_index][staged_bytes];
+            data[0] = half_pair_pixel >> 4;
+            data[1] = (half_pair_pixel << 4) | (pixel >> 8);
+            data[2] = pixel;
+            staged_bytes += 3;
+            half_pair = 0;
+            if (LCD_STAGING_BYTES - staged_bytes < 3) {
+                flush_staging(handle, 0);
+            }
+        }
+        return;
+    }
+    while (num_pixels) {
+        uint16_t length = (LCD_STAGING_BYTES - staged_bytes) / sizeof(uint16_t);
+        if (num_pixels < length) {
+            length = num_pixels;
+        }
+        memcpy(&staging_buffers[staging_index][staged_bytes], pixels, length * sizeof(uint16_t));
+        staged_bytes += length * sizeof(uint16_t);
+        pixels += length;
+        num_pixels -= length;
+        if (staged_bytes == LCD_STAGING_BYTES) {
+            flush_staging(handle, 0);
+        }
+    }
+}
+#endif
+
+
+/**
+ * @brief Send a window of the frame to the ST7735S chip.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] window Area of the frame to send.
+ * @param[in] pixels Pointer to the top-left pixel of the window.
+ * @param[in] stride Number of pixels between two rows of the window.
+ * @param[in] last 1 if the window is the last one of the frame, else 0.
+ * 
+ * @note The pixels are stored row by row.
+ * @note With LCD_BAND_RENDERING, the pixels are packed in place in 12-bit
+ * color format.
+ */
+static void send_window(const spi_device_handle_t handle, const window_t *window,
+                        uint16_t *pixels, const uint16_t stride,
+                        const uint8_t last)
+{
+    // The commands are queued behind the pixels of the previous windows
+    set_window(handle, window);
+    queue_command(handle, RAMWR, NULL, 0);
+    const uint32_t num_pixels = window->width * window->height;
+    if (window->width == stride && color_format == LCD_COLOR_FORMAT_16) {
+        // The rows of the window are contiguous
+        queue_data(handle, (const uint8_t *)pixels, num_pixels * sizeof(uint16_t), last);
+        return;
+    }
+#if (LCD_BAND_RENDERING)
+    if (window->width != stride) {
+        printf("Error(send_window): band rows must be contiguous.\n");
+        assert(0);
+    }
+    queue_data(handle, (const uint8_t *)pixels,
+               pack_pixels((uint8_t *)pixels, pixels, num_pixels), last);
+#else
+    for (uint8_t y = 0; y < window->height; y++) {
+        stage_pixels(handle, &pixels[y * stride], window->width);
+    }
+    if (half_pair) {
+        // Pad the last pixel of the window with 4 bits ignored by the ST7735S
+        staging_buffers[staging_index][staged_bytes++] = half_pair_pixel >> 4;
+        staging_buffers[staging_index][staged_bytes++] = half_pair_pixel << 4;
+        half_pair = 0;
+    }
+    flush_staging(handle, last);
+#endif
+}
+
+
+/**
+ * @brief Split a window of the display where the scrolled columns wrap
+ * around.
  * 
- * @note send_words() shall be used instead of send_bytes() when 16-bit data,
- * typically 16-bit color format, has to be sent. Making a single function for
- * both 8-bit and 16-bit data input would require processing the size of the data
- * and its length before initiating the SPI transaction. This would add unnecessary
- * load onto the processor, hence the use of the two (rather similar) functions.
+ * @param[in] window Area of the display to split.
+ * @param[out] parts Parts of the window, from left to right.
+ * @return The number of parts, 1 if the window does not wrap around.
  */
-static void send_words(const spi_device_handle_t handle, const uint16_t *data,
-                       const uint16_t len)
+static uint8_t split_window(const window_t *window, window_t parts[2])
 {
-    spi_transaction_t transaction;
-    memset(&transaction, 0, sizeof(transaction));
-    transaction.length = 8 * len;
-    transaction.tx_buffer = (void *)data;
-    
-    gpio_set_level(PIN_LCD_DC, 1); // Enable data mode
-    ESP_ERROR_CHECK(spi_device_polling_transmit(handle, &transaction));
+    if (LCD_WIDTH < window->pos_x + window->width ||
+        LCD_HEIGHT < window->pos_y + window->height) {
+        printf("Error(split_window): window is out of the frame.\n");
+        assert(0);
+    }
+    parts[0] = *window;
+    const uint8_t wrap = LCD_WIDTH - (window->pos_x + scroll) % LCD_WIDTH;
+    if (window->width <= wrap) {
+        return 1;
+    }
+    parts[0].width = wrap;
+    parts[1] = *window;
+    parts[1].pos_x += wrap;
+    parts[1].width = window->width - wrap;
+    return 2;
 }
 
 
+/**
+ * @brief Send a window of the frame to the ST7735S chip, splitting it where
+ * the scrolled columns wrap around.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] window Area of the frame to send.
+ * @param[in] pixels Pointer to the top-left pixel of the window.
+ * @param[in] stride Number of pixels between two rows of the window.
+ * @param[in] last 1 if the window is the last one of the frame, else 0.
+ */
+static void send_scrolled_window(const spi_device_handle_t handle, const window_t *window,
+                                 uint16_t *pixels, const uint16_t stride,
+                                 const uint8_t last)
+{
+    window_t parts[2];
+    if (split_window(window, parts) == 2) {
+        send_window(handle, &parts[0], pixels, stride, 0);
+        send_window(handle, &parts[1], &pixels[parts[0].width], stride, last);
+    }
+    else {
+        send_window(handle, window, pixels, stride, last);
+    }
+}
+
+
+/**
+ * @brief Fill a window of the display with the color of the fill buffer.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] window Area of the display to fill.
+ * @param[in] last 1 if the window is the last one of the frame, else 0.
+ * 
+ * @note The fill buffer is queued as many times as needed to cover the
+ * window.
+ */
+static void fill_window(const spi_device_handle_t handle, const window_t *window,
+                        const uint8_t last)
+{
+    set_window(handle, window);
+    queue_command(handle, RAMWR, NULL, 0);
+    uint32_t num_pixels = window->width * window->height;
+    while (num_pixels) {
+        const uint16_t length = (num_pixels < LCD_FILL_PIXELS) ? num_pixels : LCD_FILL_PIXELS;
+        num_pixels -= length;
+        spi_transaction_t *transaction = get_transaction(handle, LCD_TRANS_DATA |
+                                                         ((last && !num_pixels) ? LCD_TRANS_LAST : 0));
+        transaction->tx_buffer = fill_buffer;
+        if (color_format == LCD_COLOR_FORMAT_12) {
+            // Pairs of 3 bytes, the last pixel being padded if alone
+            transaction->length = 8 * (length / 2 * 3 + length % 2 * 2);
+        }
+        else {
+            transaction->length = 8 * length * sizeof(uint16_t);
+        }
+        queue_transaction(handle, transaction);
+#if (LCD_PROFILING)
+        transfer_bytes += transaction->length / 8;
+#endif
+    }
+}
+
+
+/**
+ * @brief Set the vertical scroll start address of the ST7735S chip, so that
+ * the x-position 0 of the display shows the given column.
+ * 
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] column Column shown at the x-position 0 of the display.
+ * 
+ * @note The vertical scrolling of the ST7735S moves the lines of the frame
+ * memory, which are the columns of the display once exchanged (LCD_MV).
+ */
+static void set_scroll(const spi_device_handle_t handle, const uint8_t column)
+{
+    /* With MX set, the columns are written in reverse order of the lines of
+     the frame memory: the scroll start address moves the other way. */
+    const uint8_t address = (LCD_WIDTH - column) % LCD_WIDTH;
+    const uint8_t parameters[2] = {0x00, address};
+    queue_command(handle, VSCSAD, parameters, sizeof(parameters));
+    scroll = column;
+}
+
+
+#if !(LCD_BAND_RENDERING)
+/**
+ * @brief Swap the frame buffers.
+ */
+static void swap_frame_buffers(void)
+{
+    back_buffer = (back_buffer + 1) % num_frame_buffers;
+    frame = frame_buffers[back_buffer];
+}
+#endif
+
+
 void st7735s_init_pwm_backlight(void)
 {
     // Prepare and then apply the LEDC PWM timer configuration
@@ -102,7 +644,7 @@ void st7735s_set_backlight(uint8_t percentage)
     if (percentage > 100) {
         percentage = 100;
     }
-    uint32_t duty = (uint32_t) (pow(2, PWM_LCD_RESOLUTION) - 1) * percentage / 100;
+    uint32_t duty = ((1 << PWM_LCD_RESOLUTION) - 1) * percentage / 100;
     // Set duty cycle
     ESP_ERROR_CHECK(ledc_set_duty(PWM_LCD_MODE, PWM_LCD_CHANNEL, duty));
     // Update duty to apply the new value
@@ -141,106 +683,400 @@ void st7735s_init_spi(spi_device_handle_t *handle)
         .flags = SPI_LCD_FLAGS,
         .command_bits = 0,
         .address_bits = 0,
-        .dummy_bits = 0
+        .dummy_bits = 0,
+        .pre_cb = lcd_pre_transaction,
+#if (LCD_PROFILING)
+        .post_cb = lcd_post_transaction
+#endif
     };
     ESP_ERROR_CHECK(spi_bus_add_device(SPI_LCD_HOST, &spi_dev_cfg, handle));
 }
 
 
-void st7735s_init_tft(const spi_device_handle_t handle)
+/**
+ * @brief FreeRTOS task initializing the TFT display.
+ * 
+ * @param[in] arg SPI device handle of the display.
+ */
+static void init_tft_task(void *arg)
 {
-    uint8_t parameter;
+    const spi_device_handle_t handle = (spi_device_handle_t)arg;
     // Hardware reset
     ESP_ERROR_CHECK(gpio_set_level(PIN_LCD_RES, 0));
     ets_delay_us(10);
     ESP_ERROR_CHECK(gpio_set_level(PIN_LCD_RES, 1));
-    ets_delay_us(120*1000);
+    vTaskDelay(pdMS_TO_TICKS(120) + 1);
 
-    // Reset software
-    send_command(handle, SWRESET);
-    ets_delay_us(120*1000);
+    st7735s_send_commands(handle, init_commands, sizeof(init_commands) / sizeof(lcd_command_t));
+    wait_transactions(handle);
 
-    // Sleep out
-    send_command(handle, SLPOUT);
-    ets_delay_us(250*1000);
+    xSemaphoreGive(tft_ready);
+    vTaskDelete(NULL);
+}
 
-    // Pixel format 16-bit
-    send_command(handle, COLMOD);
-    parameter = LCD_COLOR_FORMAT;
-    send_bytes(handle, &parameter, sizeof(parameter));
 
-    // Frame rate control
-    send_command(handle, FRMCTR1);
-    uint8_t param_FRMCTRL1[3] = {LCD_RTNA, LCD_FPA, LCD_BPA};
-    send_bytes(handle, param_FRMCTRL1, sizeof(param_FRMCTRL1));
+void st7735s_send_commands(const spi_device_handle_t handle, const lcd_command_t *commands,
+                           const uint8_t num_commands)
+{
+    if (commands == NULL) {
+        printf("Error(st7735s_send_commands): lcd_command_t pointer is NULL.\n");
+        assert(commands);
+    }
+    for (uint8_t i = 0; i < num_commands; i++) {
+        if (LCD_MAX_PARAMETERS < commands[i].num_parameters) {
+            printf("Error(st7735s_send_commands): too many parameters.\n");
+            assert(0);
+        }
+        queue_command(handle, commands[i].command, commands[i].parameters,
+                      commands[i].num_parameters);
+        if (commands[i].delay) {
+            wait_transactions(handle);
+            vTaskDelay(pdMS_TO_TICKS(commands[i].delay) + 1);
+        }
+    }
+}
 
-    // Memory data access control
-    send_command(handle, MADCTL);
-    parameter = ((LCD_MY << 7) | (LCD_MX << 6) | (LCD_MV << 5) |
-                (LCD_ML << 4) | (LCD_RGB << 3) | (LCD_MH << 2));
-    send_bytes(handle, &parameter, sizeof(parameter));
 
-    // Display inversion off
-    send_command(handle, INVOFF);
+void st7735s_init_tft(const spi_device_handle_t handle)
+{
+    st7735s_start_tft(handle);
+    st7735s_wait_tft();
+}
 
-    // Power control 1 - Default applied
-    send_command(handle, PWCTR1);
-    uint8_t param_PWCTR1[3] = {0xA8, 0x08, 0x84};
-    send_bytes(handle, param_PWCTR1, sizeof(param_PWCTR1));
 
-    // Power control 2 - Default applied
-    send_command(handle, PWCTR2);
-    parameter = 0xC0;
-    send_bytes(handle, &parameter, sizeof(parameter));
+void st7735s_start_tft(const spi_device_handle_t handle)
+{
+    if (tft_ready != NULL) {
+        printf("Error(st7735s_start_tft): display initialization already started.\n");
+        assert(0);
+    }
+    tft_ready = xSemaphoreCreateBinary();
+    if (tft_ready == NULL) {
+        printf("Error(st7735s_start_tft): semaphore cannot be created.\n");
+        assert(0);
+    }
+    if (xTaskCreate(init_tft_task, "init_tft", LCD_INIT_TASK_STACK, handle,
+                    LCD_INIT_TASK_PRIORITY, NULL) != pdPASS) {
+        printf("Error(st7735s_start_tft): task cannot be created.\n");
+        assert(0);
+    }
+}
 
-    // VCOM control - Default applied
-    send_command(handle, VMCTR1);
-    parameter = 0x05;
-    send_bytes(handle, &parameter, sizeof(parameter));
 
-    // Display function control
-    send_command(handle, INVCTR);
-    parameter = 0x00;
-    send_bytes(handle, &parameter, sizeof(parameter));
+void st7735s_wait_tft(void)
+{
+    if (tft_ready == NULL) {
+        printf("Error(st7735s_wait_tft): display initialization not started.\n");
+        assert(0);
+    }
+    xSemaphoreTake(tft_ready, portMAX_DELAY);
+    vSemaphoreDelete(tft_ready);
+    tft_ready = NULL;
+#if !(LCD_BAND_RENDERING)
+    // Allocated once the rest of the console (e.g. the BLE host) took its share of the heap
+    if (num_frame_buffers < NUM_FRAME_BUFFERS) {
+        frame_buffers[1] = heap_caps_calloc(LCD_NPIX, sizeof(uint16_t), MALLOC_CAP_DMA);
+        if (frame_buffers[1] == NULL) {
+            printf("Warning(st7735s_wait_tft): No memory left for the back buffer, the frames are sent from a single buffer.\n");
+        }
+        else {
+            num_frame_buffers = NUM_FRAME_BUFFERS;
+        }
+    }
+#endif
+}
 
-    // Gamma curve
-    send_command(handle, GAMSET);
-    parameter = LCD_GAMMA; 
-    send_bytes(handle, &parameter, sizeof(parameter));
 
-    // Normal display mode ON
-    send_command(handle, NORON);
-    
-    // Switch display on
-    send_command(handle, DISPON);
+void st7735s_set_frame_rate(const spi_device_handle_t handle, const uint8_t frame_rate)
+{
+    if (!frame_rate) {
+        printf("Error(st7735s_set_frame_rate): frame rate is 0.\n");
+        assert(0);
+    }
+    const uint8_t divider = (LCD_MIN_FRAME_RATE + frame_rate - 1) / frame_rate;
+    const uint32_t panel_rate = frame_rate * divider;
+    /* Frame rate = LCD_OSC_FREQ / ((RTNA x 2 + 40) x (LINE + FPA + BPA + 2)),
+     with RTNA up to 15 and the front/back porches FPA and BPA from 1 to 63.*/
+    uint8_t rtna = 0, porches = 2;
+    uint32_t best_error = UINT32_MAX;
+    for (uint8_t i = 0; i <= 15; i++) {
+        const uint32_t clocks = (i * 2 + 40) * panel_rate;
+        int32_t lines = (LCD_OSC_FREQ + clocks / 2) / clocks - LCD_WIDTH - 2;
+        lines = (lines < 2) ? 2 : (126 < lines) ? 126 : lines;
+        const uint32_t rate = LCD_OSC_FREQ / ((i * 2 + 40) * (LCD_WIDTH + lines + 2));
+        const uint32_t error = (rate < panel_rate) ? panel_rate - rate : rate - panel_rate;
+        if (error < best_error) {
+            best_error = error;
+            rtna = i;
+            porches = lines;
+        }
+    }
+    const uint8_t frame_rate_control[3] = {rtna, porches / 2, porches - porches / 2};
+    queue_command(handle, FRMCTR1, frame_rate_control, sizeof(frame_rate_control));
 
-    // Set all columns
-    send_command(handle, CASET);
-    uint8_t columns[4] = {0x00, 0x00, 0x00, 0x7F};
-    send_bytes(handle, columns, sizeof(columns));
+    if (refresh_ready == NULL) {
+        refresh_ready = xSemaphoreCreateBinary();
+        if (refresh_ready == NULL) {
+            printf("Error(st7735s_set_frame_rate): semaphore cannot be created.\n");
+            assert(0);
+        }
+    }
+#if (LCD_TE_WIRED)
+    // Signal the vertical blanking of the panel on the TE pin
+    const uint8_t mode = 0x00;
+    queue_command(handle, TEON, &mode, sizeof(mode));
+    if (te_divider) {
+        te_divider = divider;
+        return;
+    }
+    te_divider = divider;
+    const gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << PIN_LCD_TE),
+        .mode = GPIO_MODE_INPUT,
+        .intr_type = GPIO_INTR_POSEDGE
+    };
+    ESP_ERROR_CHECK(gpio_config(&io_conf));
+    gpio_install_isr_service(0); // May already be installed
+    ESP_ERROR_CHECK(gpio_isr_handler_add(PIN_LCD_TE, lcd_te_isr, NULL));
+#else
+    if (refresh_timer == NULL) {
+        const esp_timer_create_args_t timer_args = {
+            .callback = lcd_refresh_timer,
+            .name = "lcd_refresh"
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &refresh_timer));
+    }
+    else {
+        ESP_ERROR_CHECK(esp_timer_stop(refresh_timer));
+    }
+    ESP_ERROR_CHECK(esp_timer_start_periodic(refresh_timer, 1000000 / frame_rate));
+#endif
+}
 
-    // Set all rows
-    send_command(handle, RASET);
-    uint8_t rows[4] = {0x00, 0x00, 0x00, 0x9F};
-    send_bytes(handle, rows, sizeof(rows));
+
+void st7735s_wait_refresh(void)
+{
+    if (refresh_ready != NULL) {
+        xSemaphoreTake(refresh_ready, portMAX_DELAY);
+    }
 }
 
 
-void st7735s_push_frame(const spi_device_handle_t handle)
+void st7735s_wait_frame(const spi_device_handle_t handle)
+{
+#if (LCD_PROFILING)
+    const int64_t wait_start = esp_timer_get_time();
+    const uint8_t profiled = (queued_transactions != 0);
+#endif
+    wait_transactions(handle);
+#if (LCD_PROFILING)
+    if (!profiled) {
+        return;
+    }
+    blocked_time += esp_timer_get_time() - wait_start;
+    transfer_time += transfer_end - transfer_start;
+    if (++profiled_frames == LCD_PROFILING_FRAMES) {
+        printf("LCD(profiling): %d-bit, %lu bytes/frame, transfer %lld us/frame, CPU blocked %lld us/frame, CPU freed %lld us/frame\n",
+               (color_format == LCD_COLOR_FORMAT_12) ? 12 : 16, transfer_bytes / profiled_frames,
+               transfer_time / profiled_frames, blocked_time / profiled_frames,
+               (transfer_time - blocked_time) / profiled_frames);
+        transfer_time = 0;
+        blocked_time = 0;
+        transfer_bytes = 0;
+        profiled_frames = 0;
+    }
+#endif
+}
+
+
+#if !(LCD_BAND_RENDERING)
+void st7735s_present_frame(const spi_device_handle_t handle)
+{
+    const window_t full_window = {
+        .width = LCD_WIDTH,
+        .height = LCD_HEIGHT
+    };
+    // The previous frame shall be fully sent before its buffer is drawn again
+    st7735s_wait_frame(handle);
+    if (scroll) {
+        set_scroll(handle, 0);
+    }
+#if (LCD_PROFILING)
+    transfer_start = esp_timer_get_time();
+#endif
+    // Queue the frame to the ST7735S LCD driver.
+    send_window(handle, &full_window, frame, LCD_STRIDE, 1);
+    swap_frame_buffers();
+    if (num_frame_buffers == 1) {
+        // The next frame is drawn on the frame being sent
+        st7735s_wait_frame(handle);
+    }
+}
+
+
+void st7735s_present_windows(const spi_device_handle_t handle, const window_t *windows,
+                             const uint8_t num_windows)
+{
+    if (windows == NULL) {
+        printf("Error(st7735s_present_windows): window_t pointer is NULL.\n");
+        assert(windows);
+    }
+    // The previous frame shall be fully sent before its buffer is drawn again
+    st7735s_wait_frame(handle);
+#if (LCD_PROFILING)
+    transfer_start = esp_timer_get_time();
+#endif
+    for (uint8_t i = 0; i < num_windows; i++) {
+        uint16_t *pixels = &frame[windows[i].pos_y * LCD_STRIDE + windows[i].pos_x];
+        send_scrolled_window(handle, &windows[i], pixels, LCD_STRIDE, (i == num_windows - 1));
+    }
+    swap_frame_buffers();
+    if (num_frame_buffers == 1) {
+        // The next frame is drawn on the frame being sent
+        st7735s_wait_frame(handle);
+    }
+}
+#endif
+
+
+void st7735s_set_color_format(const spi_device_handle_t handle, const uint8_t format)
+{
+    if (format != LCD_COLOR_FORMAT_12 && format != LCD_COLOR_FORMAT_16) {
+        printf("Error(st7735s_set_color_format): color format not supported.\n");
+        assert(0);
+    }
+    if (format == color_format) {
+        return;
+    }
+    // The pixels queued before keep the previous format
+    queue_command(handle, COLMOD, &format, sizeof(format));
+    color_format = format;
+}
+
+
+void st7735s_fill_windows(const spi_device_handle_t handle, const window_t *windows,
+                          const uint8_t num_windows, const uint16_t color, const uint8_t last)
 {
-    send_command(handle, RAMWR);
-    // Push the frame to the ST7735S LCD driver.
-    for (uint16_t i = 0; i < NUM_TRANSACTIONS; i++) {
-        if (REMAINING_PIXELS && (i == NUM_TRANSACTIONS - 1)) {
-            // Extract the last pixels to avoid sending garbage values
-            uint16_t last_pixels[REMAINING_PIXELS] = {0};
-            for (uint16_t j = 0; j < REMAINING_PIXELS; j++) {
-                last_pixels[j] = frame[i][j];
+    if (windows == NULL) {
+        printf("Error(st7735s_fill_windows): window_t pointer is NULL.\n");
+        assert(windows);
+    }
+    if (!num_windows) {
+        return;
+    }
+    if (fill_color != color || fill_format != color_format) {
+        // The fill buffer may still be sent by the previous fills
+        wait_transactions(handle);
+        if (color_format == LCD_COLOR_FORMAT_12) {
+            const uint16_t pixel = get_rgb444(color);
+            for (uint16_t i = 0; i < LCD_FILL_PIXELS / 2 * 3; i += 3) {
+                fill_buffer[i] = pixel >> 4;
+                fill_buffer[i + 1] = (pixel << 4) | (pixel >> 8);
+                fill_buffer[i + 2] = pixel;
             }
-            send_words(handle, last_pixels, REMAINING_PIXELS * sizeof(uint16_t));
         }
         else {
-            send_words(handle, frame[i], MAX_TRANSFER_SIZE);
+            for (uint16_t i = 0; i < LCD_FILL_PIXELS; i++) {
+                ((uint16_t *)fill_buffer)[i] = color;
+            }
         }
+        fill_color = color;
+        fill_format = color_format;
+    }
+#if (LCD_BAND_RENDERING) && (LCD_PROFILING)
+    if (!band_count) {
+        transfer_start = esp_timer_get_time();
+    }
+#endif
+    for (uint8_t i = 0; i < num_windows; i++) {
+        window_t parts[2];
+        const uint8_t num_parts = split_window(&windows[i], parts);
+        for (uint8_t j = 0; j < num_parts; j++) {
+            fill_window(handle, &parts[j], last && (i == num_windows - 1) && (j == num_parts - 1));
+        }
+    }
+#if (LCD_BAND_RENDERING)
+    band_count = last ? 0 : band_count + 1;
+#endif
+}
+
+
+void st7735s_scroll_display(const spi_device_handle_t handle, const int16_t dx)
+{
+    int16_t column = (scroll + dx) % LCD_WIDTH;
+    if (column < 0) {
+        column += LCD_WIDTH;
     }
+    set_scroll(handle, column);
+}
+
+
+#if (LCD_BAND_RENDERING)
+uint8_t st7735s_get_scroll_wrap(void)
+{
+    return (LCD_WIDTH - scroll) % LCD_WIDTH;
+}
+
+
+uint16_t *st7735s_get_band(void)
+{
+    return band_buffers[band_index];
+}
+
+
+void st7735s_send_band(const spi_device_handle_t handle, const window_t *window,
+                       const uint8_t last)
+{
+    if (window == NULL) {
+        printf("Error(st7735s_send_band): window_t pointer is NULL.\n");
+        assert(window);
+    }
+    if (BAND_WIDTH < window->width) {
+        printf("Error(st7735s_send_band): band is wider than BAND_WIDTH.\n");
+        assert(0);
+    }
+#if (LCD_PROFILING)
+    if (!band_count) {
+        transfer_start = esp_timer_get_time();
+    }
+#endif
+    // The previous band shall be fully sent before its buffer is drawn again
+    wait_transactions(handle);
+    send_scrolled_window(handle, window, band_buffers[band_index], window->width, last);
+    band_index = !band_index;
+    band_count = last ? 0 : band_count + 1;
+}
+#else
+void st7735s_sync_frame(const window_t *windows, const uint8_t num_windows)
+{
+    if (num_frame_buffers == 1) {
+        // The frame is the last frame presented
+        return;
+    }
+    const uint16_t *front = frame_buffers[(back_buffer + NUM_FRAME_BUFFERS - 1) % NUM_FRAME_BUFFERS];
+    if (windows == NULL) {
+        memcpy(frame, front, LCD_NPIX * sizeof(uint16_t));
+        return;
+    }
+    for (uint8_t i = 0; i < num_windows; i++) {
+        for (uint8_t y = windows[i].pos_y; y < windows[i].pos_y + windows[i].height; y++) {
+            const uint16_t index = y * LCD_STRIDE + windows[i].pos_x;
+            memcpy(&frame[index], &front[index], windows[i].width * sizeof(uint16_t));
+        }
+    }
+}
+
+
+uint8_t st7735s_get_num_frame_buffers(void)
+{
+    return num_frame_buffers;
+}
+
+
+void st7735s_push_frame(const spi_device_handle_t handle)
+{
+    st7735s_wait_refresh();
+    st7735s_present_frame(handle);
+    st7735s_wait_frame(handle);
 }
+#endif
@@ -1,553 +0,0 @@
-#include "sprites.h"
-
-
-/*************************************************
- * The Shire
- ************************************************/
-
-const uint16_t shire_block_water[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbf5e, 0xbf5e, 0xfa04, 0xfa04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbf5e, 0xff05, 0xff05, 0xff05, 0xff05, 0xfa04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xbf5e, 0xbf5e, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xfa04, 0xfa04, 0x0000, 0x0000, 0x0000, 
-  0xff05, 0xbf5e, 0xbf5e, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xfa04, 0xfa04, 0xff05, 
-  0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 
-  0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 
-  0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 
-  0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 
-  0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 0xff05, 
-  0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 
-  0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 
-  0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 
-  0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804, 0x9804
-};
-
-const uint16_t shire_block_1[]  = {
-  0x0000, 0xb4ae, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x6012, 0x0000, 
-  0xb4ae, 0x001e, 0x001e, 0xb4ae, 0x6012, 0x6012, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x6012, 
-  0xb4ae, 0x001e, 0x001e, 0xb4ae, 0x6012, 0x6012, 0x001e, 0x001e, 0x001e, 0x001e, 0xb4ae, 0x6012, 0x6012, 0x001e, 0x001e, 0x6012, 
-  0xb4ae, 0x2092, 0x2092, 0xb4ae, 0x6012, 0x6012, 0x001e, 0x001e, 0x2092, 0x2092, 0xb4ae, 0x6012, 0x6012, 0x001e, 0x001e, 0x6012, 
-  0xb4ae, 0x2092, 0x2092, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x2092, 0x2092, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0x2092, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040
-};
-
-const uint16_t shire_block_1_1[]  = {
-  0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0xd4dd, 0x2092, 0x2092, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0xe040, 0xe040, 0xe040, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0xd4dd, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0x2092, 0xe040, 0xe040, 
-  0x2092, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040, 0xe040
-};
-
-const uint16_t shire_block_2[]  = {
-  0x0000, 0xb2f6, 0xb2f6, 0xb2f6, 0x2cf6, 0x4172, 0xb2f6, 0xb2f6, 0xb2f6, 0x2cf6, 0x4172, 0xb2f6, 0xb2f6, 0xb2f6, 0x2cf6, 0x0000, 
-  0x029b, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 
-  0x029b, 0xb2f6, 0x18f7, 0x18f7, 0x49ac, 0x4172, 0xb2f6, 0x18f7, 0x18f7, 0x49ac, 0x4172, 0xb2f6, 0x18f7, 0x18f7, 0x49ac, 0x4172, 
-  0x029b, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2ec5, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 
-  0x0000, 0xb2f6, 0x2cf6, 0x2ec5, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2ec5, 0x49ac, 0x0000, 
-  0x0000, 0xb2f6, 0x2cf6, 0x2ec5, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2ec5, 0x49ac, 0x0000, 
-  0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 
-  0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2ec5, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 
-  0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2ec5, 0x2cf6, 0x49ac, 0x0000, 
-  0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2ec5, 0x2cf6, 0x49ac, 0x0000, 
-  0x0000, 0xb2f6, 0x2ec5, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 
-  0x0000, 0xb2f6, 0x2ec5, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2ec5, 0x2cf6, 0x49ac, 0x0000, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x0000, 
-  0x029b, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2ec5, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 
-  0x029b, 0xb2f6, 0x18f7, 0x18f7, 0x49ac, 0x4172, 0xb2f6, 0x18f7, 0x18f7, 0x49ac, 0x4172, 0xb2f6, 0x18f7, 0x18f7, 0x49ac, 0x4172, 
-  0x029b, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2cf6, 0x2cf6, 0x49ac, 0x4172, 0xb2f6, 0x2cf6, 0x4bd5, 0x49ac, 0x4172, 
-  0x0000, 0x2cf6, 0x49ac, 0x49ac, 0x49ac, 0x4172, 0x2cf6, 0x49ac, 0x49ac, 0x49ac, 0x4172, 0x2cf6, 0x49ac, 0x49ac, 0x49ac, 0x0000
-};
-
-const uint16_t shire_block_3[]  = {
-  0x0000, 0x0000, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x0000, 0x0000, 
-  0x0000, 0x407a, 0x6bed, 0x6bed, 0x20ec, 0x407a, 0x6bed, 0x6bed, 0x6bed, 0x20ec, 0x407a, 0x6bed, 0x6bed, 0x6bed, 0x407a, 0x0000, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 0x20ec, 0xa0cb, 0xa0cb, 0xa0cb, 0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x6bed, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x20ec, 0xa0cb, 0xa0cb, 0xa0cb, 0x407a, 0x51ff, 0x51ff, 0x80fe, 0x80fe, 0x407a, 0x20ec, 0xa0cb, 0xa0cb, 0xa0cb, 0x407a, 
-  0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x80fe, 0x80fe, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 
-  0x407a, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0x407a, 0x407a, 0x407a, 0x407a, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x6bed, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x6bed, 0x6bed, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0xa0cb, 0xa0cb, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0xa0cb, 0xa0cb, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x20ec, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0x407a, 
-  0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 
-  0x407a, 0x407a, 0x407a, 0x407a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x407a, 0x407a, 0x407a, 0x407a
-};
-
-const uint16_t shire_block_3_1[]  = {
-  0x0000, 0x0000, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x0000, 0x0000, 
-  0x0000, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x0000, 
-  0x407a, 0x407a, 0x407a, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0x407a, 0x407a, 0x407a, 
-  0x407a, 0x407a, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0x407a, 0x407a, 
-  0x407a, 0x407a, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0x407a, 0x407a, 
-  0x407a, 0x407a, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0x407a, 0x407a, 
-  0x407a, 0x407a, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0xe030, 0x407a, 0x407a, 
-  0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0xe030, 0xe030, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 
-  0x407a, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0x407a, 0x407a, 0x407a, 0x407a, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x6bed, 0x6bed, 0x6bed, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0x6bed, 0x6bed, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x6bed, 0x6bed, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x6bed, 0x20ec, 0xa0cb, 0xa0cb, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0x20ec, 0xa0cb, 0xa0cb, 0x20ec, 0xa0cb, 0x407a, 
-  0x407a, 0x20ec, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0xa0cb, 0x407a, 
-  0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 0x407a, 
-  0x407a, 0x407a, 0x407a, 0x407a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x407a, 0x407a, 0x407a, 0x407a
-};
-
-const uint16_t shire_enemy_1[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d85, 0x0d85, 0x0d85, 0x0d85, 0x0d85, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0d85, 0x0d85, 0x0d85, 0x0d85, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0d85, 0x0d85, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0d85, 0x0d85, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xa742, 
-  0x0000, 0x0000, 0x0000, 0x0d85, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xc963, 0xa742, 
-  0x0000, 0x96b5, 0x96b5, 0x0d85, 0xc963, 0xc04c, 0xc04c, 0xc043, 0xc963, 0xc04c, 0xc043, 0xc963, 0xc043, 0xc04c, 0xc04c, 0xa742, 
-  0x96b5, 0x4005, 0x4005, 0x0d85, 0xc04c, 0xc043, 0xc043, 0x602a, 0xc963, 0xc04c, 0xc043, 0xc963, 0x602a, 0xc043, 0xc043, 0xc04c, 
-  0x96b5, 0x4005, 0xe007, 0x0d85, 0xc04c, 0xc043, 0xc043, 0x602a, 0xc963, 0xc04c, 0xc043, 0xc963, 0x602a, 0xc043, 0xc043, 0xc04c, 
-  0x96b5, 0x718c, 0x718c, 0x718c, 0xc04c, 0xc043, 0xc043, 0x602a, 0xc963, 0xc04c, 0xc043, 0xc963, 0x602a, 0xc043, 0xc043, 0xc04c, 
-  0x96b5, 0x718c, 0x718c, 0x718c, 0xc04c, 0xc043, 0x602a, 0xc963, 0xc963, 0xc043, 0x602a, 0xa742, 0xa742, 0x602a, 0xc043, 0xc04c, 
-  0x0000, 0xffff, 0xffff, 0x8a52, 0xc04c, 0xc043, 0x602a, 0xa742, 0xa742, 0xc043, 0x602a, 0xa742, 0x0000, 0x602a, 0xc043, 0xc04c, 
-  0x0000, 0xffff, 0xffff, 0x0000, 0xc043, 0xc043, 0x0000, 0x0000, 0x0000, 0xc043, 0x0000, 0x0000, 0x0000, 0x0000, 0xc043, 0xc043, 
-  0x0000, 0xffff, 0x0000, 0x0000, 0xc043, 0x602a, 0x0000, 0x0000, 0x0000, 0xc043, 0x0000, 0x0000, 0x0000, 0x0000, 0x602a, 0xc043, 
-  0x0000, 0xffff, 0x0000, 0x0000, 0xc043, 0x0000, 0x0000, 0x0000, 0x0000, 0xc043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc043, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xc043, 0x0000, 0x0000, 0x0000, 0x0000, 0xc043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc043
-};
-
-
-/*************************************************
- * The Mines of Moria
- ************************************************/
-
-const uint16_t moria_block_1[]  = {
-  0x0000, 0x905b, 0x905b, 0x905b, 0x0000, 0x0000, 0x0000, 0x905b, 0x905b, 0x905b, 0x905b, 0x905b, 0xcd42, 0x905b, 0x905b, 0x0000, 
-  0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x0000, 0x905b, 0xcd42, 0xcd42, 0x6300, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0x6300, 
-  0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xd06b, 0x6300, 0x6300, 0x6300, 0x905b, 0xcd42, 0x6300, 
-  0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xd06b, 0xd06b, 0xe510, 0x6300, 0x6300, 0x6300, 
-  0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x5284, 0xd06b, 0x6300, 
-  0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0x6300, 
-  0x905b, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x5284, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0x6300, 
-  0x905b, 0xcd42, 0xcd42, 0x6300, 0x5284, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x6300, 
-  0x905b, 0xcd42, 0x6300, 0x5284, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 
-  0x905b, 0xcd42, 0x6300, 0x5284, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0x6300, 0xcd42, 0xcd42, 0x6300, 
-  0x905b, 0xcd42, 0x6300, 0x5284, 0xcd42, 0xcd42, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0xd06b, 0xcd42, 0xcd42, 0x6300, 
-  0x905b, 0xcd42, 0x6300, 0x5284, 0x6300, 0x6300, 0xd06b, 0xd06b, 0xe510, 0x5284, 0xd06b, 0xd06b, 0xcd42, 0xcd42, 0xcd42, 0x6300, 
-  0x905b, 0xcd42, 0x6300, 0x6300, 0xd06b, 0xd06b, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 
-  0x6300, 0x6300, 0xe510, 0x5284, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 
-  0xd06b, 0xd06b, 0x6300, 0x5284, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x0000, 0x905b, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x6300, 0x0000, 
-  0x0000, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x0000, 0x0000, 0x0000, 0x6300, 0x6300, 0x6300, 0x6300, 0x0000, 0x0000
-};
-
-const uint16_t moria_block_2[]  = {
-  0x0000, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0x0000, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0x0000, 
-  0xc829, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0xb89d, 0xc829, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0xb89d, 0xc829, 
-  0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 
-  0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 
-  0xc829, 0xb89d, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xc829, 0xb89d, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xc829, 
-  0x0000, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0x0000, 
-  0xc829, 0x5c9e, 0x5c9e, 0xb89d, 0xc829, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0xb89d, 0xc829, 0x5c9e, 0x5c9e, 0xb89d, 0xc829, 
-  0xc829, 0x5c9e, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xcd42, 0xc829, 
-  0xc829, 0x5c9e, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xcd42, 0xc829, 
-  0xc829, 0xb89d, 0xcd42, 0xcd42, 0xc829, 0xb89d, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xc829, 0xb89d, 0xcd42, 0xcd42, 0xc829, 
-  0x0000, 0xc829, 0xc829, 0xc829, 0xb89d, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xb89d, 0xc829, 0xc829, 0xc829, 0x0000, 
-  0xc829, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0xb89d, 0xc829, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0xb89d, 0xc829, 
-  0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 
-  0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 0x5c9e, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xb89d, 0xcd42, 0xc829, 
-  0xc829, 0xb89d, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xc829, 0xb89d, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xc829, 
-  0x0000, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0x0000, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0xc829, 0x0000
-};
-
-const uint16_t moria_block_3[]  = {
-  0x0000, 0x0000, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x0000, 0x0000, 
-  0x0000, 0xcd42, 0x5c9e, 0x5c9e, 0x788d, 0xcd42, 0x5c9e, 0x5c9e, 0x5c9e, 0x788d, 0xcd42, 0x5c9e, 0x5c9e, 0x5c9e, 0xcd42, 0x0000, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 0x788d, 0x536c, 0x536c, 0x536c, 0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x5c9e, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x788d, 0x536c, 0x536c, 0x536c, 0xcd42, 0x51ff, 0x51ff, 0x51ff, 0x80fe, 0xcd42, 0x788d, 0x536c, 0x536c, 0x536c, 0xcd42, 
-  0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x80fe, 0x80fe, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 
-  0xcd42, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x5c9e, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x5c9e, 0x5c9e, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x536c, 0x536c, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x536c, 0x536c, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x788d, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0xcd42, 
-  0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 
-  0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcd42, 0xcd42, 0xcd42, 0xcd42
-};
-
-const uint16_t moria_block_3_1[]  = {
-  0x0000, 0x0000, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x0000, 0x0000, 
-  0x0000, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x0000, 
-  0xcd42, 0xcd42, 0xcd42, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0xcd42, 0xcd42, 0xcd42, 
-  0xcd42, 0xcd42, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0xcd42, 0xcd42, 
-  0xcd42, 0xcd42, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0xcd42, 0xcd42, 
-  0xcd42, 0xcd42, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0xcd42, 0xcd42, 
-  0xcd42, 0xcd42, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0x4621, 0xcd42, 0xcd42, 
-  0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x4621, 0x4621, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 
-  0xcd42, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x5c9e, 0x5c9e, 0x5c9e, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x5c9e, 0x5c9e, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x5c9e, 0x5c9e, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x5c9e, 0x788d, 0x536c, 0x536c, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x788d, 0x536c, 0x536c, 0x788d, 0x536c, 0xcd42, 
-  0xcd42, 0x788d, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0x536c, 0xcd42, 
-  0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 0xcd42, 
-  0xcd42, 0xcd42, 0xcd42, 0xcd42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcd42, 0xcd42, 0xcd42, 0xcd42
-};
-
-const uint16_t moria_enemy_1[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x576b, 0x576b, 0x576b, 0x576b, 0x576b, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x576b, 0x576b, 0x576b, 0x576b, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x576b, 0x576b, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x576b, 0x576b, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0xcd18, 
-  0x0000, 0x0000, 0x0000, 0x576b, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0x554a, 0xcd18, 
-  0x0000, 0x96b5, 0x96b5, 0x576b, 0x554a, 0xff89, 0xff89, 0x1a50, 0x554a, 0xff89, 0x1a50, 0x554a, 0x1a50, 0xff89, 0xff89, 0xcd18, 
-  0x96b5, 0x00b0, 0x00b0, 0x576b, 0xff89, 0x1a50, 0x1a50, 0x0e30, 0x554a, 0xff89, 0x1a50, 0x554a, 0x0e30, 0x1a50, 0x1a50, 0xff89, 
-  0x96b5, 0x00b0, 0x00f8, 0x576b, 0xff89, 0x1a50, 0x1a50, 0x0e30, 0x554a, 0xff89, 0x1a50, 0x554a, 0x0e30, 0x1a50, 0x1a50, 0xff89, 
-  0x96b5, 0x718c, 0x718c, 0x718c, 0xff89, 0x1a50, 0x1a50, 0x0e30, 0x554a, 0xff89, 0x1a50, 0x554a, 0x0e30, 0x1a50, 0x1a50, 0xff89, 
-  0x96b5, 0x718c, 0x718c, 0x718c, 0xff89, 0x1a50, 0x0e30, 0x554a, 0x554a, 0x1a50, 0x0e30, 0xcd18, 0xcd18, 0x0e30, 0x1a50, 0xff89, 
-  0x0000, 0xffff, 0xffff, 0x8a52, 0xff89, 0x1a50, 0x0e30, 0xcd18, 0xcd18, 0x1a50, 0x0e30, 0xcd18, 0x0000, 0x0e30, 0x1a50, 0xff89, 
-  0x0000, 0xffff, 0xffff, 0x0000, 0x1a50, 0x1a50, 0x0000, 0x0000, 0x0000, 0x1a50, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a50, 0x1a50, 
-  0x0000, 0xffff, 0x0000, 0x0000, 0x1a50, 0x0e30, 0x0000, 0x0000, 0x0000, 0x1a50, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e30, 0x1a50, 
-  0x0000, 0xffff, 0x0000, 0x0000, 0x1a50, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a50, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a50, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1a50, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a50, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a50
-};
-
-const uint16_t moria_enemy_2[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x4064, 0x4064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x208e, 0x208e, 0xb7e7, 0xb7e7, 0xb7e7, 0x0000, 0x0000, 0x0000, 0x208e, 0x2075, 0x4064, 0x4064, 0x0000, 0x0000, 
-  0x0000, 0x40f7, 0x208e, 0xb7e7, 0x208e, 0x208e, 0xb7e7, 0xb7e7, 0x208e, 0x2075, 0x2075, 0x4064, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x40f7, 0x208e, 0x208e, 0x208e, 0x208e, 0xb7e7, 0x208e, 0x2075, 0x2075, 0x4064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x20ce, 0x208e, 0x40f7, 0x20ce, 0x208e, 0xb7e7, 0x2075, 0x2075, 0x4064, 0x435a, 0x435a, 0x435a, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x208e, 0x208e, 0x40f7, 0x20ce, 0x208e, 0x2075, 0x2075, 0x4064, 0x4064, 0xc372, 0xc372, 0x435a, 0x435a, 0x0000, 0x0000, 
-  0x0000, 0x208e, 0x208e, 0x20ce, 0x208e, 0x208e, 0x2075, 0x4064, 0x4064, 0xb7e7, 0xc372, 0xc372, 0xc372, 0x435a, 0x435a, 0x0000, 
-  0x0000, 0x2032, 0x208e, 0x208e, 0x208e, 0x208e, 0xc085, 0xc085, 0xb7e7, 0x4064, 0x4064, 0xc372, 0xc372, 0xc372, 0x435a, 0x0000, 
-  0x0000, 0x2032, 0x2032, 0xc085, 0xc085, 0xe042, 0xe042, 0xc372, 0xb7e7, 0x4064, 0x4064, 0xc372, 0xc372, 0xc372, 0x435a, 0x435a, 
-  0x0000, 0x0000, 0x2032, 0xc085, 0x0060, 0xe042, 0xe042, 0x4064, 0x4064, 0x4064, 0xe042, 0xc372, 0xc372, 0xc372, 0x435a, 0x435a, 
-  0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x0060, 0x0060, 0xe042, 0xe042, 0xe042, 0xc372, 0xc372, 0xc372, 0xc372, 0x435a, 0x435a, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x0060, 0xc372, 0x4064, 0xc372, 0xc372, 0xc372, 0x2075, 0x435a, 0x435a, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0xc372, 0xc372, 0x4064, 0xe042, 0xc372, 0x0000, 0x2075, 0x435a, 0x4064, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4064, 0xc372, 0x4064, 0x4064, 0x2075, 0xc372, 0x2075, 0x2075, 0x2075, 0x4064, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4064, 0x4064, 0xe042, 0xe042, 0x2075, 0x2075, 0x4064, 0x4064, 0x4064, 0x0000, 0x0000
-};
-
-const uint16_t moria_platform_block_1[]  = {
-  0x0000, 0x0000, 0x2ff6, 0xa2dc, 0x8edd, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 
-  0x0000, 0xa2dc, 0x02c4, 0x2ff6, 0x02c4, 0x8edd, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 
-  0xa2dc, 0x02c4, 0x81ab, 0xc1b3, 0x8cdd, 0xc1b3, 0x4ccd, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 
-  0x02c4, 0x81ab, 0x81ab, 0x81ab, 0x8cdd, 0x81ab, 0x4ccd, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 
-  0x009b, 0x81ab, 0x81ab, 0x81ab, 0x8cdd, 0x81ab, 0x4ccd, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 
-  0x807a, 0x009b, 0x81ab, 0x41a3, 0x8cdd, 0x41a3, 0x4ccd, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 
-  0x0000, 0x807a, 0x009b, 0x4cd5, 0x009b, 0x8ab4, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 
-  0x0000, 0x4cd5, 0x8ab4, 0x807a, 0x8ab4, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 
-  0x0000, 0x4cd5, 0x0000, 0x8ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x4cd5, 0x0000, 0x8ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x4cd5, 0x0000, 0x8ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x4cd5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x4cd5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x4cd5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t moria_platform_block_2[]  = {
-  0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0xa2dc, 0x8cdd, 0xa2dc, 0x8cdd, 0xa2dc, 0xa2dc, 0x0000, 0x0000, 
-  0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x02c4, 0x8cdd, 0x02c4, 0x8cdd, 0x02c4, 0xa2dc, 0x0000, 
-  0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0xc1b3, 0x8cdd, 0xc1b3, 0x8cdd, 0x02c4, 0xa2dc, 
-  0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x8cdd, 0x81ab, 0x8cdd, 0x81ab, 0x02c4, 
-  0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x81ab, 0x8cdd, 0x81ab, 0x8cdd, 0x81ab, 0x009b, 
-  0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x41a3, 0x8cdd, 0x41a3, 0x8cdd, 0x009b, 0x807a, 
-  0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x8ab4, 0x009b, 0x8ab4, 0x009b, 0x807a, 0x0000, 
-  0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x807a, 0x8ab4, 0x807a, 0x8ab4, 0x807a, 0x807a, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8ab4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-
-/*************************************************
- * Items
- ************************************************/
-
-const uint16_t sprite_coin_1[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x70ff, 0x70ff, 0x70ff, 0x70ff, 0x70ff, 0xa0fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x70ff, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x0000, 0x0000, 
-  0x0000, 0x70ff, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0x70ff, 0x70ff, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x0000, 
-  0x0000, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0x70ff, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x0000, 
-  0x0000, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x0000, 
-  0x0000, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x0000, 
-  0x0000, 0x70ff, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x66d5, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x0000, 
-  0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x66d5, 0x66d5, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x66d5, 0x0000, 
-  0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x66d5, 0x66d5, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x66d5, 0x66d5, 0x66d5, 0x66d5, 0x66d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_coin_2[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x50ff, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0x67d5, 0xa0fe, 0xa0fe, 0x50ff, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0x67d5, 0xa0fe, 0xa0fe, 0x50ff, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0x67d5, 0xa0fe, 0xa0fe, 0x50ff, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0x67d5, 0xa0fe, 0xa0fe, 0x50ff, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x50ff, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0xa0fe, 0xa0fe, 0xa0fe, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_coin_3[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0fe, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x67d5, 0x67d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_shield[]  = {
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x75ad, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x75ad, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x0000, 0x0000, 
-  0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x0000, 
-  0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x0000, 
-  0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 
-  0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0xffff, 0xbef7, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 
-  0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0xffff, 0xffff, 0xbef7, 0xbef7, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 
-  0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0xbef7, 0xbef7, 0xfbde, 0xfbde, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 
-  0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0xbef7, 0xfbde, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 
-  0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 
-  0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x0000, 
-  0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x0000, 
-  0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x75ad, 0x75ad, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x75ad, 0x75ad, 0x0000, 0x0000, 0x0000, 
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x75ad, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff
-};
-
-const uint16_t sprite_lightstaff[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x60a3, 0x60a3, 0x2093, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x2093, 0x5def, 0x2093, 0x2093, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2093, 0x2093, 0x5def, 0xffff, 0x5def, 0x2093, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x2093, 0x2093, 0x5def, 0x2093, 0x8072, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2093, 0x2093, 0x2093, 0x8072, 0x8072, 0x8072, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x60a3, 0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x2093, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_lightstaff_equipped[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x60a3, 0x60a3, 0x2093, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x2093, 0x5def, 0x2093, 0x2093, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2093, 0x2093, 0x5def, 0xffff, 0x5def, 0x2093, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x2093, 0x2093, 0x2093, 0x5def, 0x2093, 0x8072, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60a3, 0x2093, 0x2093, 0x2093, 0x2093, 0x2093, 0x2093, 0x8072, 0x8072, 0x8072, 0x0000, 
-  0x0000, 0x0000, 0x60a3, 0x2093, 0x2093, 0x2093, 0x2093, 0x2093, 0x8072, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x60a3, 0x2093, 0x2093, 0x2093, 0x2093, 0x8072, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x2093, 0x2093, 0x8072, 0x8072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_shield_edge[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9294, 0x3ce7, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9294, 0xffff, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9294, 0xffff, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9294, 0x3ce7, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad, 0xffff, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75ad
-};
-
-
-/*************************************************
- * Miscellaneous
- ************************************************/
-
-const uint16_t sprite_player[]  = {
-  0x0000, 0x0000, 0x0000, 0xb294, 0xcb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xb294, 0xb294, 0xb294, 0xcb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xcb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xcb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xcb5a, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xcb5a, 0xcb5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xcb5a, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xcb5a, 0xb294, 0xb294, 
-  0x0000, 0x0000, 0x0000, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xcb5a, 0xcb5a, 0xb294, 0xb294, 0xb294, 0xb294, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0xb294, 0xb294, 0xb294, 0xb294, 0xcb5a, 0xcb5a, 0xb294, 0xb294, 0xb294, 0xb294, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0xb294, 0xb294, 0xb294, 0xcb5a, 0xcb5a, 0xb294, 0xb294, 0xb294, 0xb294, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0xb294, 0x7def, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0xb294, 0xb294, 0xb294, 0x9453, 0xaf3a, 0x2c32, 0x2c32, 0x7def, 0x7def, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x9453, 0x9453, 0xaf3a, 0x2c32, 0x2c32, 0x7def, 0x7def, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x9453, 0x9453, 0xaf3a, 0xaf3a, 0x2c32, 0x2c32, 0x7def, 0x7def, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x9453, 0x9453, 0xaf3a, 0xaf3a, 0xaf3a, 0x2c32, 0x2c32, 0x7def, 0x7def, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x9453, 0x9453, 0xaf3a, 0xaf3a, 0xaf3a, 0xaf3a, 0x2c32, 0x2c32, 0x7def, 0x7def, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x9453, 0x9453, 0xaf3a, 0xaf3a, 0xaf3a, 0xaf3a, 0xaf3a, 0x2c32, 0x2c32, 0x2c32, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_torch[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0x80a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0x80a9, 0x80a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0xc7e4, 0xc7e4, 0x80a9, 0x80a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0xc7e4, 0x4dfe, 0x4dfe, 0xc7e4, 0x80a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0xc7e4, 0x4dfe, 0xffff, 0xffff, 0x4dfe, 0xc7e4, 0x80a9, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0xc7e4, 0x4dfe, 0xffff, 0x4dfe, 0x4dfe, 0xc7e4, 0x80a9, 0x0000, 0x31e6, 0x31e6, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0xc7e4, 0x4dfe, 0x4dfe, 0xc7e4, 0xa0e3, 0xa0e3, 0x31e6, 0x31e6, 0xa0e4, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0xc7e4, 0xc7e4, 0x648a, 0x648a, 0x0000, 0x0000, 0x0000, 0x0000, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80a9, 0x80a9, 0x80a9, 0x648a, 0x068b, 0x068b, 0x0000, 0x0000, 0x0000, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x068b, 0x206a, 0x8249, 0x0000, 0x0000, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x206a, 0x206a, 0x8249, 0x0000, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8249, 0x8249, 0x0000, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31e6, 0x31e6, 0xa0e4, 0xc0b3, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa0e4, 0xc0b3, 0xc0b3
-};
-
-const uint16_t sprite_projectile[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7bd, 0xf7bd, 0xf7bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7bd, 0xf7bd, 0x718c, 0x14a5, 0x14a5, 0x14a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf7bd, 0xf7bd, 0x718c, 0x718c, 0x14a5, 0xf7bd, 0xf7bd, 0x14a5, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf7bd, 0x14a5, 0x14a5, 0x14a5, 0xf7bd, 0x14a5, 0x14a5, 0x718c, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf7bd, 0xf7bd, 0xf7bd, 0x718c, 0xf7bd, 0x14a5, 0x14a5, 0x718c, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7bd, 0x14a5, 0x718c, 0xf7bd, 0x14a5, 0x14a5, 0x718c, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x718c, 0x718c, 0x14a5, 0x14a5, 0xf7bd, 0x718c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf7bd, 0x718c, 0x718c, 0x718c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_ring_1[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x2dff, 0x2dff, 0x2dff, 0x60fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 
-  0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x20cd, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x0000, 
-  0x0000, 0x2dff, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60fe, 0x60fe, 0x60fe, 0x0000, 
-  0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 
-  0x2dff, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 
-  0x2dff, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 
-  0x2dff, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 
-  0x2dff, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 
-  0x60fe, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 
-  0x0000, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x0000, 
-  0x0000, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x2dff, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 
-  0x0000, 0x0000, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x2dff, 0x2dff, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60fe, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_ring_2[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x2dff, 0x2dff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60fe, 0x60fe, 0x60fe, 0x60fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint16_t sprite_ring_3[]  = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x2dff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2dff, 0x60fe, 0x60fe, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20cd, 0x20cd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
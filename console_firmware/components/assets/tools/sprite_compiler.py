@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+"""
+@file sprite_compiler.py
+@brief Compile the bitmaps of the assets into the sprites.c and sprites.h
+sources, as listed by a manifest (see bitmap/sprites.txt).
+
+Each line of the manifest reads `<bitmap> <name> <encoding> [<variants>]`:
+  - bitmap: BMP file, relative to the manifest, of 16 or 24 bits per pixel
+    (16-bit files with the RGB565 bit fields).
+  - name: name of the C symbol of the sprite.
+  - encoding: `rgb565` for a `const uint16_t` array in the format sent to
+    the display (byte-swapped RGB565), or `indexed` for an indexed_data_t of
+    4 bits per pixel (8 bits above 16 colors), whose palette starts with
+    black, the transparent color. Its opacity (type, bounding box of the
+    opaque pixels, and largest rectangle of opaque pixels) is measured here,
+    so that the driver does not measure it at run time.
+  - variants: comma-separated orientations also compiled, each as the sprite
+    `<name>_<variant>`: flip_x, flip_y, flip_xy, cw_90, acw_90. They are the
+    sprite as drawn with the same flags by st7735s_draw_sprite(). The variants
+    of indexed sprites share the palette of the sprite, and are listed in its
+    `variants`, so that the driver draws them in place of the flipped or
+    rotated sprite.
+
+Each sprite is preceded by a comment giving its metadata: size, number of
+colors, bounding box of the opaque pixels, and opacity.
+
+Usage: sprite_compiler.py <manifest> <output directory>
+"""
+
+import os
+import struct
+import sys
+
+
+VARIANTS = ("flip_x", "flip_y", "flip_xy", "cw_90", "acw_90")
+ENCODINGS = ("rgb565", "indexed")
+BLACK = 0x0000
+
+
+class Sprite:
+    """Sprite pixels in the format sent to the display, row by row."""
+
+    def __init__(self, name, width, height, pixels):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.pixels = pixels
+
+    def pixel(self, x, y):
+        return self.pixels[y * self.width + x]
+
+
+def fail(message):
+    sys.exit("Error(sprite_compiler): " + message)
+
+
+def read_bitmap(path):
+    """Read a BMP file into byte-swapped RGB565 pixels, top row first."""
+    with open(path, "rb") as file:
+        data = file.read()
+    if data[:2] != b"BM":
+        fail(f"{path} is not a BMP file.")
+    offset, = struct.unpack_from("<I", data, 10)
+    width, height, _, bpp, compression = struct.unpack_from("<iiHHI", data, 18)
+    if bpp == 16:
+        masks = struct.unpack_from("<III", data, 54) if compression == 3 else None
+        if masks != (0xF800, 0x07E0, 0x001F):
+            fail(f"{path}: 16-bit bitmaps shall use the RGB565 bit fields.")
+    elif bpp != 24 or compression != 0:
+        fail(f"{path}: {bpp} bits per pixel not supported (16 or 24 expected).")
+    row_size = (width * bpp + 31) // 32 * 4
+    pixels = []
+    for y in range(abs(height)):
+        # Rows are stored bottom-up, unless the height is negative
+        row = offset + ((abs(height) - 1 - y) if 0 < height else y) * row_size
+        for x in range(width):
+            if bpp == 16:
+                color, = struct.unpack_from("<H", data, row + 2 * x)
+            else:
+                blue, green, red = data[row + 3 * x:row + 3 * x + 3]
+                color = ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3)
+            # The display receives the most significant byte first
+            pixels.append(((color & 0xFF) << 8) | (color >> 8))
+    return width, abs(height), pixels
+
+
+def orient(sprite, variant):
+    """Get a variant of a sprite, as drawn by st7735s_draw_sprite()."""
+    w, h = sprite.width, sprite.height
+    name = f"{sprite.name}_{variant}"
+    if variant == "cw_90":
+        # The rows of the sprite are shown right to left
+        return Sprite(name, h, w, [sprite.pixel(y, h - 1 - x) for y in range(w) for x in range(h)])
+    if variant == "acw_90":
+        # The columns of the sprite are shown bottom to top
+        return Sprite(name, h, w, [sprite.pixel(w - 1 - y, x) for y in range(w) for x in range(h)])
+    flip_x = variant in ("flip_x", "flip_xy")
+    flip_y = variant in ("flip_y", "flip_xy")
+    return Sprite(name, w, h, [sprite.pixel(w - 1 - x if flip_x else x, h - 1 - y if flip_y else y)
+                               for y in range(h) for x in range(w)])
+
+
+def get_palette(sprite):
+    """Colors of the sprite by order of appearance, black first."""
+    palette = [BLACK]
+    for color in sprite.pixels:
+        if color not in palette:
+            palette.append(color)
+    if 256 < len(palette):
+        fail(f"{sprite.name} has more than 256 colors.")
+    return palette
+
+
+def measure_opacity(sprite):
+    """Opacity of a sprite, as measured by measure_opacity() of the driver:
+    its type, the bounding box of its opaque pixels, and its largest
+    rectangle of opaque pixels, found row by row as the largest rectangle
+    under the histogram of the opaque pixels above each row."""
+    w, h = sprite.width, sprite.height
+    heights = [0] * w
+    num_opaque, best = 0, 0
+    bounds = [w - 1, h - 1, 0, 0]
+    opaque_box = (0, 0, 0, 0)
+    for y in range(h):
+        for x in range(w):
+            if sprite.pixel(x, y) == BLACK:
+                heights[x] = 0
+                continue
+            heights[x] += 1
+            num_opaque += 1
+            bounds = [min(x, bounds[0]), min(y, bounds[1]), max(x, bounds[2]), y]
+        # Each column ends the rectangles of the higher columns on its left
+        stack = []
+        for x in range(w + 1):
+            height = heights[x] if x < w else 0
+            while stack and height <= heights[stack[-1]]:
+                top = heights[stack.pop()]
+                left = stack[-1] + 1 if stack else 0
+                if best < top * (x - left):
+                    best = top * (x - left)
+                    opaque_box = (left, y - top + 1, x - 1, y)
+            stack.append(x)
+    if num_opaque == 0:
+        return "SPRITE_TRANSPARENT", (0, 0, 0, 0), (0, 0, 0, 0)
+    opacity = "SPRITE_OPAQUE" if num_opaque == w * h else "SPRITE_MIXED"
+    return opacity, tuple(bounds), opaque_box
+
+
+def describe(sprite, palette):
+    """Metadata comment of a sprite."""
+    opaque = [(i % sprite.width, i // sprite.width) for i, color in enumerate(sprite.pixels) if color != BLACK]
+    if not opaque:
+        box, opacity = "none", "transparent"
+    else:
+        xs, ys = [x for x, _ in opaque], [y for _, y in opaque]
+        box = f"({min(xs)}, {min(ys)}) to ({max(xs)}, {max(ys)})"
+        opacity = "opaque" if len(opaque) == len(sprite.pixels) else "mixed"
+    return (f"// {sprite.width}x{sprite.height}, {len(palette)} colors (black included), "
+            f"opaque pixels within {box}, {opacity}\n")
+
+
+def format_values(values, per_line, digits):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(f"0x{value:0{digits}x}" for value in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def emit_rgb565(sprite):
+    palette = get_palette(sprite)
+    return (describe(sprite, palette) +
+            f"const uint16_t {sprite.name}[] = {{\n" +
+            format_values(sprite.pixels, sprite.width, 4) + "\n};\n")
+
+
+def emit_indexed(sprite, palette, palette_name, variants=()):
+    """Indices of the sprite, and its indexed_data_t referring to the palette
+    and to the variants already emitted."""
+    bpp = 4 if len(palette) <= 16 else 8
+    indices = [palette.index(color) for color in sprite.pixels]
+    if bpp == 4:
+        # Pairs of pixels, the left one in the high nibble
+        if len(indices) % 2:
+            indices.append(0)
+        indices = [(indices[i] << 4) | indices[i + 1] for i in range(0, len(indices), 2)]
+    per_line = max(1, sprite.width * bpp // 8)
+    source = (f"static const uint8_t {sprite.name}_indices[] = {{\n" +
+              format_values(indices, per_line, 2) + "\n};\n\n")
+    if variants:
+        source += (f"static const indexed_data_t *const {sprite.name}_variants[SPRITE_NUM_VARIANTS] = {{\n" +
+                   ",\n".join(f"    [SPRITE_{variant.upper()}] = &{name}" for variant, name in variants) +
+                   "\n};\n\n")
+    opacity, bounds, opaque_box = measure_opacity(sprite)
+    source += (f"const indexed_data_t {sprite.name} = {{\n"
+               f"    .bpp = {bpp},\n"
+               f"    .num_colors = {len(palette)},\n"
+               f"    .opacity = {{\n"
+               f"        .type = {opacity},\n"
+               f"        .bounds = {{{', '.join(map(str, bounds))}}},\n"
+               f"        .opaque_box = {{{', '.join(map(str, opaque_box))}}}\n"
+               f"    }},\n"
+               f"    .palette = {palette_name},\n"
+               f"    .indices = {sprite.name}_indices" +
+               (f",\n    .variants = {sprite.name}_variants\n" if variants else "\n") +
+               "};\n")
+    return source
+
+
+def emit_palette(sprite, palette):
+    return (describe(sprite, palette) +
+            f"static const uint16_t {sprite.name}_palette[] = {{\n" +
+            format_values(palette, 16, 4) + "\n};\n")
+
+
+def read_manifest(path):
+    entries = []
+    with open(path) as file:
+        for number, line in enumerate(file, 1):
+            fields = line.split("#", 1)[0].split()
+            if not fields:
+                continue
+            if len(fields) not in (3, 4) or fields[2] not in ENCODINGS:
+                fail(f"{path}:{number}: expected `<bitmap> <name> <encoding> [<variants>]`, "
+                     f"with an encoding among {', '.join(ENCODINGS)}.")
+            variants = fields[3].split(",") if len(fields) == 4 else []
+            for variant in variants:
+                if variant not in VARIANTS:
+                    fail(f"{path}:{number}: unknown variant `{variant}`.")
+            entries.append((fields[0], fields[1], fields[2], variants))
+    return entries
+
+
+def main():
+    if len(sys.argv) != 3:
+        fail("usage: sprite_compiler.py <manifest> <output directory>")
+    manifest, output = sys.argv[1], sys.argv[2]
+    source = ['// Generated by tools/sprite_compiler.py from bitmap/sprites.txt, do not edit.\n'
+              '#include "sprites.h"\n']
+    declarations = []
+    for bitmap, name, encoding, variants in read_manifest(manifest):
+        width, height, pixels = read_bitmap(os.path.join(os.path.dirname(manifest), bitmap))
+        sprite = Sprite(name, width, height, pixels)
+        oriented = [orient(sprite, variant) for variant in variants]
+        if encoding == "rgb565":
+            for compiled in [sprite] + oriented:
+                source.append(emit_rgb565(compiled))
+                declarations.append(f"extern const uint16_t {compiled.name}[{compiled.width * compiled.height}];")
+            continue
+        # The variants come first, to be listed by the sprite
+        palette = get_palette(sprite)
+        blocks = [describe(compiled, palette) + emit_indexed(compiled, palette, f"{name}_palette")
+                  for compiled in oriented]
+        blocks.append(emit_indexed(sprite, palette, f"{name}_palette",
+                                   [(variant, compiled.name) for variant, compiled in zip(variants, oriented)]))
+        source.append(emit_palette(sprite, palette) + "\n" + "\n\n".join(blocks))
+        for compiled in [sprite] + oriented:
+            declarations.append(f"extern const indexed_data_t {compiled.name};")
+    header = (
+        "/**\n"
+        " * @file sprites.h\n"
+        " * @brief Header file containing the sprites external declarations.\n"
+        " * \n"
+        " * @note Generated by tools/sprite_compiler.py from bitmap/sprites.txt.\n"
+        " */\n\n"
+        "#ifndef __SPRITES_H__\n"
+        "#define __SPRITES_H__\n\n\n"
+        "#include <stdint.h>\n\n"
+        '#include "st7735s_graphics.h"\n\n\n' +
+        "\n".join(declarations) + "\n\n\n"
+        "#endif // __SPRITES_H__\n")
+    os.makedirs(os.path.join(output, "include"), exist_ok=True)
+    with open(os.path.join(output, "include", "sprites.h"), "w") as file:
+        file.write(header)
+    with open(os.path.join(output, "sprites.c"), "w") as file:
+        file.write("\n\n".join(source))
+
+
+if __name__ == "__main__":
+    main()
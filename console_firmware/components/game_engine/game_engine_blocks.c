@@ -405,6 +405,9 @@ void compute_interactive_block(game_t *game, block_t *block)
         case BREAKABLE_BLOCK:
             block->destroyed = 1;
             block->is_hit = 0;
+            // The block leaves the static layer
+            st7735s_invalidate_layer(BLOCK_SIZE * block->row - game->cam_pos_x,
+                                     BLOCK_SIZE * (NUM_BLOCKS_Y - 1 - block->column), BLOCK_SIZE, BLOCK_SIZE);
             break;
         case BONUS_BLOCK:
             if (!block->item_given) {
@@ -419,6 +422,8 @@ void compute_interactive_block(game_t *game, block_t *block)
                 store_item(&item);
                 block->bumping = 1;
                 block->item_given = 1;
+                st7735s_invalidate_layer(BLOCK_SIZE * block->row - game->cam_pos_x,
+                                         BLOCK_SIZE * (NUM_BLOCKS_Y - 1 - block->column), BLOCK_SIZE, BLOCK_SIZE);
             }
             block->is_hit = 0;
             break;
@@ -1,6 +1,7 @@
 #include "game_engine.h"
 
-#define OUT_OF_RANGE(x)     (3 * LCD_WIDTH / 4 < x)
+#define RANGE               (3 * LCD_WIDTH / 4)
+#define OUT_OF_RANGE(x)     (RANGE < (x))
 
 
 enemy_t enemies[NUM_ENEMY_RECORDS] = {0};
@@ -46,7 +47,7 @@ void shoot_projectile(const physics_t *shooter, const physics_t *target)
         else {
             const uint16_t dist_x = abs(projectiles[i].physics.pos_x - target->pos_x);
             const uint16_t dist_y = abs(projectiles[i].physics.pos_y - target->pos_y);
-            if (OUT_OF_RANGE(hypot((uint16_t)dist_x, (uint16_t)dist_y))) {
+            if (0 < compare_distance(dist_x, dist_y, RANGE)) {
                 memset(&projectiles[i], 0, sizeof(projectiles[i]));
                 projectiles[i] = projectile;
                 return;
@@ -536,7 +537,7 @@ uint8_t is_on_sight(const map_t *map, physics_t *shooter, physics_t *target)
     // Check if on range
     int16_t dist_x = target->pos_x - shooter->pos_x;
     int16_t dist_y = target->pos_y - shooter->pos_y;
-    uint16_t dist = hypot(abs(dist_x), abs(dist_y));
+    uint16_t dist = get_distance(dist_x, dist_y);
     if (OUT_OF_RANGE(dist)) {
         return 0;
     }
@@ -554,11 +555,11 @@ uint8_t is_on_sight(const map_t *map, physics_t *shooter, physics_t *target)
         // Horizontal adjacent block
         dist_x = target->pos_x - BLOCK_SIZE * h_adja_block_row;
         dist_y = target->pos_y - BLOCK_SIZE * (NUM_BLOCKS_Y - h_adja_block_col - 1);
-        uint16_t h_adja_block_dist = hypot(abs(dist_x), abs(dist_y));
+        uint16_t h_adja_block_dist = get_distance(dist_x, dist_y);
         // Vertical adjacent block
         dist_x = target->pos_x - BLOCK_SIZE * v_adja_block_row;
         dist_y = target->pos_y - BLOCK_SIZE * (NUM_BLOCKS_Y - v_adja_block_col - 1);
-        uint16_t v_adja_block_dist = hypot(abs(dist_x), abs(dist_y));
+        uint16_t v_adja_block_dist = get_distance(dist_x, dist_y);
         // Check for solid block on the shortest path
         if (h_adja_block_dist < v_adja_block_dist) {
             if (IS_SOLID(map->data[h_adja_block_row][h_adja_block_col])) {
@@ -587,7 +588,7 @@ uint8_t is_on_sight(const map_t *map, physics_t *shooter, physics_t *target)
             dist_y = target->pos_y - BLOCK_SIZE * (NUM_BLOCKS_Y - v_adja_block_col - 1);
             h_adja_block_col = v_adja_block_col;
             v_adja_block_row = h_adja_block_row;
-            dist = hypot(abs(dist_x), abs(dist_y));
+            dist = get_distance(dist_x, dist_y);
         }
     }
     // If no block is solid, the target is on sight
@@ -626,7 +627,7 @@ void compute_enemy(game_t *game, player_t *player, enemy_t *enemy,
     if (player->lightstaff && player->power_used) {
         uint8_t dist_x = abs(player->physics.pos_x - enemy->physics.pos_x);
         uint8_t dist_y = abs(player->physics.pos_y - enemy->physics.pos_y);
-        if (hypot(dist_x, dist_y) < player->spell_radius) {
+        if (compare_distance(dist_x, dist_y, player->spell_radius) < 0) {
             enemy->life--;
         }
     }
@@ -1,4 +1,5 @@
 #include "game_engine.h"
+#include "fonts.h"
 #include "sprites.h"
 
 #define TIMESTEP_BUMP_BLOCK     5           // in milliseconds
@@ -32,23 +33,23 @@ static void animate_coin(const game_t *game, player_t *player, item_t *item)
     }
     // Change the coin sprite 
     const uint8_t next_sprite = (item->steps % 3 == 1);
-    if (item->sprite.data == NULL) {
-        item->sprite.data = sprite_coin_1;
+    if (item->sprite.indexed == NULL) {
+        item->sprite.indexed = &sprite_coin_1;
     }
-    if (next_sprite && item->sprite.data == sprite_coin_1) {
-        item->sprite.data = sprite_coin_2;
+    if (next_sprite && item->sprite.indexed == &sprite_coin_1) {
+        item->sprite.indexed = &sprite_coin_2;
     }
-    else if (next_sprite && item->sprite.data == sprite_coin_2 &&
+    else if (next_sprite && item->sprite.indexed == &sprite_coin_2 &&
             !item->sprite.flip_x) {
-        item->sprite.data = sprite_coin_3;
+        item->sprite.indexed = &sprite_coin_3;
     }
-    else if (next_sprite && item->sprite.data == sprite_coin_3) {
-        item->sprite.data = sprite_coin_2;
+    else if (next_sprite && item->sprite.indexed == &sprite_coin_3) {
+        item->sprite.indexed = &sprite_coin_2;
         item->sprite.flip_x = 1;
     }
-    else if (next_sprite && item->sprite.data == sprite_coin_2 &&
+    else if (next_sprite && item->sprite.indexed == &sprite_coin_2 &&
             item->sprite.flip_x) {
-        item->sprite.data = sprite_coin_1;
+        item->sprite.indexed = &sprite_coin_1;
         item->sprite.flip_x = 0;
     }
     item->timer = (uint32_t)game->timer;
@@ -80,14 +81,14 @@ static void draw_item(const game_t *game, player_t *player, item_t *item)
             animate_coin(game, player, item);
             break;
         case LIGHTSTAFF:
-            item->sprite.data = sprite_lightstaff;
+            item->sprite.indexed = &sprite_lightstaff;
             if (item->steps <= BLOCK_SIZE) {
                 item->steps++;
                 item->sprite.pos_y--;
             }
             break;
         case SHIELD:
-            item->sprite.data = sprite_shield;
+            item->sprite.indexed = &sprite_shield;
             if (item->steps <= BLOCK_SIZE) {
                 item->steps++;
                 item->sprite.pos_y--;
@@ -96,7 +97,7 @@ static void draw_item(const game_t *game, player_t *player, item_t *item)
         default:
             break;
     }
-    if (item->sprite.data != NULL) {
+    if (item->sprite.indexed != NULL) {
         st7735s_draw_sprite(&item->sprite);
     }
 }
@@ -142,24 +143,26 @@ static void bump_block(const game_t *game, block_t *block, sprite_t *sprite)
  * @param x x-center of the spotlight (reference: map_x = 0).
  * @param y y-center of the spotlight (reference: display).
  * @param radius Spotlight radius, in pixels.
+ * 
+ * @note The spotlight is drawn with the other lights, see build_frame().
  */
 static void create_spotlight(const game_t *game, const int16_t x, const int8_t y,
                              const uint8_t radius)
 {
-    circle_t circle = {
+    light_t light = {
         .pos_y = y,
         .color = YELLOW_1,
-        .alpha = 0.8,
+        .alpha = ALPHA_MAX * 8 / 10,
         .radius = radius,
     };
     // Simple light animation
     if (game->timer % 4 < 2) {
-        circle.pos_x = x - game->cam_pos_x + 7;
+        light.pos_x = x - game->cam_pos_x + 7;
     }
     else {
-        circle.pos_x = x - game->cam_pos_x + 9;
+        light.pos_x = x - game->cam_pos_x + 9;
     }
-    st7735s_draw_circle(&circle);
+    st7735s_add_light(&light);
 }
 
 
@@ -173,46 +176,72 @@ static void create_spotlight(const game_t *game, const int16_t x, const int8_t y
 static void animate_ring(const game_t *game, sprite_t *sprite)
 {
     static item_t ring = {
-        .sprite.data = sprite_ring_1,
+        .sprite.indexed = &sprite_ring_1,
     };
     if ((game->timer - ring.timer) / TIMESTEP_BUMP_COIN < 1) {
         return;
     }
     ring.steps++;
-    circle_t circle = {
+    light_t halo = {
         .pos_x = sprite->pos_x + BLOCK_SIZE / 2,
         .pos_y = sprite->pos_y + BLOCK_SIZE / 2 - 1,
         .color = YELLOW_1,
-        .alpha = 0.9,
+        .alpha = ALPHA_MAX * 9 / 10,
         .radius = 20,
     };
     // Simple light animation
     if (ring.steps % 6 < 3) {
-        circle.radius = 21;
+        halo.radius = 21;
     }
     else {
-        circle.radius = 20;
+        halo.radius = 20;
     }
-    st7735s_draw_circle(&circle);
+    st7735s_add_light(&halo);
     const uint8_t next_sprite = (ring.steps % 6 == 1);
-    if (next_sprite && ring.sprite.data == sprite_ring_1) {
-        ring.sprite.data = sprite_ring_2;
+    if (next_sprite && ring.sprite.indexed == &sprite_ring_1) {
+        ring.sprite.indexed = &sprite_ring_2;
     }
-    else if (next_sprite && ring.sprite.data == sprite_ring_2 &&
+    else if (next_sprite && ring.sprite.indexed == &sprite_ring_2 &&
             !ring.sprite.flip_x) {
-        ring.sprite.data = sprite_ring_3;
+        ring.sprite.indexed = &sprite_ring_3;
     }
-    else if (next_sprite && ring.sprite.data == sprite_ring_3) {
-        ring.sprite.data = sprite_ring_2;
+    else if (next_sprite && ring.sprite.indexed == &sprite_ring_3) {
+        ring.sprite.indexed = &sprite_ring_2;
         ring.sprite.flip_x = 1;
     }
-    else if (next_sprite && ring.sprite.data == sprite_ring_2 &&
+    else if (next_sprite && ring.sprite.indexed == &sprite_ring_2 &&
             ring.sprite.flip_x) {
-        ring.sprite.data = sprite_ring_1;
+        ring.sprite.indexed = &sprite_ring_1;
         ring.sprite.flip_x = 0;
     }
     ring.timer = (uint32_t)game->timer;
-    sprite->data = ring.sprite.data;
+    sprite->indexed = ring.sprite.indexed;
+}
+
+
+/**
+ * @brief Check if a block is drawn on the static layer, as it is neither
+ * recorded nor animated.
+ * 
+ * @param game Game flags.
+ * @param row Row of the block.
+ * @param column Column of the block.
+ * @return 1 if the block is on the static layer, else 0.
+ * 
+ * @note Only the interactive blocks get a state record, the others are
+ * checked without scanning the records.
+ * @note Both the loops of build_frame() and draw_block() rely on it, so
+ * that a block is drawn once, on the static layer or over it.
+ */
+static uint8_t is_static_block(const game_t *game, const int16_t row, const int8_t column)
+{
+    const int8_t block = game->map->data[row][NUM_BLOCKS_Y - 1 - column];
+    if (block == BACKGROUND_BLOCK || block == RING ||
+        (game->map->id == MORIA && (block == CUSTOM_SPRITE_2 || block == CUSTOM_SPRITE_3))) {
+        return 0;
+    }
+    uint8_t block_index;
+    return !IS_INTERACTIVE(block) || !get_block_record(&block_index, row, NUM_BLOCKS_Y - 1 - column);
 }
 
 
@@ -238,6 +267,7 @@ static void draw_block(const game_t *game, const int16_t row, const int8_t colum
     // Check the state of the current block
     if (get_block_record(&block_index, row, NUM_BLOCKS_Y - 1 - column)) {
         block_state_found = 1;
+        // Its area was invalidated once destroyed, see compute_interactive_block()
         if (blocks[block_index].destroyed) {
             return;
         }
@@ -245,8 +275,12 @@ static void draw_block(const game_t *game, const int16_t row, const int8_t colum
             bump_block(game, &blocks[block_index], &sprite);
         }
     }
+    /* Blocks that are neither recorded nor animated never change: draw them
+     on the static layer, so that they are only sent when scrolled in. */
+    st7735s_set_static_layer(is_static_block(game, row, column));
+    const int8_t block = game->map->data[row][NUM_BLOCKS_Y - 1 - column];
     // Assign graphic asset(s) to the block
-    switch (game->map->data[row][NUM_BLOCKS_Y - 1 - column]) {
+    switch (block) {
         case CUSTOM_SPRITE_4:
             switch (game->map->id) {
                 case MORIA:
@@ -277,7 +311,7 @@ static void draw_block(const game_t *game, const int16_t row, const int8_t colum
                 case MORIA:
                     create_spotlight(game, row * BLOCK_SIZE, column * BLOCK_SIZE + 5, 10);
                     sprite.flip_x = 1;
-                    sprite.data = sprite_torch;
+                    sprite.indexed = &sprite_torch;
                     break;
                 default: break;    
             }
@@ -293,42 +327,42 @@ static void draw_block(const game_t *game, const int16_t row, const int8_t colum
                         .color = BLACK
                     };
                     st7735s_draw_rectangle(&rectangle);
-                    sprite.data = moria_block_1;
+                    sprite.indexed = &moria_block_1;
                     break;
                 case MORIA:
                     create_spotlight(game, row * BLOCK_SIZE - 1, column * BLOCK_SIZE + 5, 10);
-                    sprite.data = sprite_torch;
+                    sprite.indexed = &sprite_torch;
                     break;
                 default: break;
             }
             break;
         case CUSTOM_SPRITE_1:
             switch (game->map->id) {
-                case SHIRE: sprite.data = shire_block_water; break;
+                case SHIRE: sprite.indexed = &shire_block_water; break;
                 case MORIA: 
-                    sprite.data = shire_block_water; 
-                    sprite.alpha = 0.5;
+                    sprite.indexed = &shire_block_water; 
+                    sprite.alpha = ALPHA_MAX / 2;
                     break;
                 default: break;
             }
             break;
         case NON_BREAKABLE_BLOCK_1:
             switch (game->map->id) {
-                case SHIRE: sprite.data = shire_block_1; break;
-                case MORIA: sprite.data = moria_block_1; break;
+                case SHIRE: sprite.indexed = &shire_block_1; break;
+                case MORIA: sprite.indexed = &moria_block_1; break;
                 default: break;  
             }
             break;
         case NON_BREAKABLE_BLOCK_2:
             switch (game->map->id) {
-                case SHIRE: sprite.data = shire_block_1_1; break;
+                case SHIRE: sprite.indexed = &shire_block_1_1; break;
                 default: break;
             }
             break;
         case BREAKABLE_BLOCK:
             switch (game->map->id) {
-                case SHIRE: sprite.data = shire_block_2; break;
-                case MORIA: sprite.data = moria_block_2; break;
+                case SHIRE: sprite.indexed = &shire_block_2; break;
+                case MORIA: sprite.indexed = &moria_block_2; break;
                 default:
                     break;
             }
@@ -336,12 +370,12 @@ static void draw_block(const game_t *game, const int16_t row, const int8_t colum
         case BONUS_BLOCK:
             switch (game->map->id) {
                 case SHIRE: 
-                    if (block_state_found && blocks[block_index].item_given) sprite.data = shire_block_3_1;
-                    else sprite.data = shire_block_3;
+                    if (block_state_found && blocks[block_index].item_given) sprite.indexed = &shire_block_3_1;
+                    else sprite.indexed = &shire_block_3;
                     break;
                 case MORIA:
-                    if (block_state_found && blocks[block_index].item_given) sprite.data = moria_block_3_1;
-                    else sprite.data = moria_block_3;
+                    if (block_state_found && blocks[block_index].item_given) sprite.indexed = &moria_block_3_1;
+                    else sprite.indexed = &moria_block_3;
                     break;
                 default: break;
             }
@@ -355,7 +389,8 @@ static void draw_block(const game_t *game, const int16_t row, const int8_t colum
             break;
         default: break;
     }
-    if (sprite.data != NULL) st7735s_draw_sprite(&sprite);
+    if (sprite.indexed != NULL) st7735s_draw_sprite(&sprite);
+    st7735s_set_static_layer(0);
 }
 
 
@@ -387,11 +422,11 @@ static void draw_platform(const game_t *game, const platform_t *platform)
         case SHIRE:
             break;
         case MORIA:
-            platform_left.data = moria_platform_block_1;
-            platform_right.data = moria_platform_block_2;
+            platform_left.indexed = &moria_platform_block_1;
+            platform_right.indexed = &moria_platform_block_2;
         break;
     }
-    if (platform_left.data != NULL && platform_right.data != NULL) {
+    if (platform_left.indexed != NULL && platform_right.indexed != NULL) {
         st7735s_draw_sprite(&platform_left);
         st7735s_draw_sprite(&platform_right);
     }
@@ -414,7 +449,7 @@ static void draw_projectile(const game_t *game, const projectile_t *projectile)
         .pos_y = projectile->physics.pos_y,
         .height = BLOCK_SIZE,
         .width = BLOCK_SIZE,
-        .data = sprite_projectile,
+        .indexed = &sprite_projectile,
     };
     if (projectile->physics.speed_x < 0) {
         sprite.flip_x = 1;
@@ -446,33 +481,33 @@ static void draw_enemy(const game_t *game, const enemy_t *enemy)
     switch(game->map->data[enemy->row][enemy->column]) {
         case ENEMY_1:
             switch (game->map->id) {
-                case SHIRE: sprite.data = shire_enemy_1; break;
-                case MORIA: sprite.data = moria_enemy_1; break;
+                case SHIRE: sprite.indexed = &shire_enemy_1; break;
+                case MORIA: sprite.indexed = &moria_enemy_1; break;
                 default: break;
             }
             break;
         case ENEMY_2:
             switch (game->map->id) {
-                case MORIA: sprite.data = moria_enemy_2; break;
+                case MORIA: sprite.indexed = &moria_enemy_2; break;
                 default: break;
             }
             break;
         case ENEMY_3:
             switch (game->map->id) {
-                case MORIA: sprite.data = moria_enemy_2; break;
+                case MORIA: sprite.indexed = &moria_enemy_2; break;
                 default: break;
             }
             break;
         case ENEMY_4:
             switch (game->map->id) {
-                case MORIA: sprite.data = moria_enemy_1; break;
+                case MORIA: sprite.indexed = &moria_enemy_1; break;
                 default: break;
             }
             break;
         default:
             break;
     }
-    if (sprite.data != NULL) {
+    if (sprite.indexed != NULL) {
         st7735s_draw_sprite(&sprite);
     }
 }
@@ -491,10 +526,10 @@ uint8_t transition_screen(const uint16_t color, const uint8_t fade_in)
     // On-going transition
     if (steps < 100) {
         if (fade_in) {
-            rectangle.alpha = (float)(100 - steps) / 100;
+            rectangle.alpha = (100 - steps) * ALPHA_MAX / 100;
         }
         else {
-            rectangle.alpha = (float)steps / 100;
+            rectangle.alpha = steps * ALPHA_MAX / 100;
         }
         st7735s_draw_rectangle(&rectangle);
         steps += 2;
@@ -505,7 +540,7 @@ uint8_t transition_screen(const uint16_t color, const uint8_t fade_in)
         rectangle.alpha = 0;
     }
     else {
-        rectangle.alpha = 1;
+        rectangle.alpha = ALPHA_MAX;
     }
     st7735s_draw_rectangle(&rectangle);
     steps = 0;
@@ -540,7 +575,7 @@ void draw_player(const game_t *game, player_t *player)
             .width = BLOCK_SIZE,
             .pos_x = player->sprite.pos_x - BLOCK_SIZE,
             .pos_y = player->sprite.pos_y,
-            .data = sprite_shield_edge,
+            .indexed = &sprite_shield_edge,
             .alpha = SHIELD_ALPHA,
         };
         st7735s_draw_sprite(&shield_edge);
@@ -571,7 +606,7 @@ void draw_player(const game_t *game, player_t *player)
             .height = BLOCK_SIZE,
             .pos_x = player->sprite.pos_x,
             .pos_y = player->sprite.pos_y,
-            .data = sprite_lightstaff_equipped
+            .indexed = &sprite_lightstaff_equipped
         };
         if (!player->forward) {
             lightstaff.flip_x = 1;
@@ -599,7 +634,7 @@ void draw_player(const game_t *game, player_t *player)
             .pos_x = 0,
             .pos_y = 0,
             .color = WHITE,
-            .alpha = (float)(player->spell_radius - LCD_SIZE) / 100.0
+            .alpha = (player->spell_radius - LCD_SIZE) * ALPHA_MAX / 100
         };
         st7735s_draw_rectangle(&rectangle);
     }
@@ -628,20 +663,47 @@ void build_frame(game_t *game, player_t *player)
         printf("Error(build_frame): player_t pointer is NULL.\n");
         assert(player);
     }
+    static uint16_t cam_pos_x = 0;
+    // Let the display shift what is already shown along with the camera
+    st7735s_scroll_frame(game->cam_pos_x - cam_pos_x);
+    cam_pos_x = game->cam_pos_x;
     st7735s_fill_background(game->map->background_color);
+    /* Draw the static blocks on the static layer, which the display driver
+     may cache: then only the columns scrolled in or invalidated are drawn. */
+    int16_t x0, x1;
+    if (st7735s_begin_layer(&x0, &x1)) {
+        // Blocks overlapping the columns, including the ones drawn past their cell
+        int16_t first_row = (game->cam_pos_x + x0) / BLOCK_SIZE - 1;
+        int16_t last_row = (game->cam_pos_x + x1) / BLOCK_SIZE + 1;
+        first_row = (first_row < game->cam_row) ? game->cam_row : first_row;
+        last_row = (game->cam_row + NUM_BLOCKS_X < last_row) ? game->cam_row + NUM_BLOCKS_X : last_row;
+        last_row = (game->map->nrows - 1 < last_row) ? game->map->nrows - 1 : last_row;
+        for (int16_t row = first_row; row <= last_row; row++) {
+            for (int column = 0; column < NUM_BLOCKS_Y; column++) {
+                if (is_static_block(game, row, column)) {
+                    draw_block(game, row, column);
+                }
+            }
+        }
+    }
+    st7735s_end_layer();
     // Draw items
     for (uint8_t i = 0; i < NUM_ITEMS; i++) {
         draw_item(game, player, &items[i]);
     }
-    // Draw blocks
+    // Draw the other blocks
     for (uint8_t row = game->cam_row; row <= game->cam_row + NUM_BLOCKS_X; row++) {
         if (game->map->nrows - 1 < row) {
             break;
         }
         for (int column = 0; column < NUM_BLOCKS_Y; column++) {
-            draw_block(game, row, column);
+            if (!is_static_block(game, row, column)) {
+                draw_block(game, row, column);
+            }
         }
     }
+    // Tint what is drawn so far with the torches and the ring halo, at once
+    st7735s_draw_lights();
     // Draw platforms
     for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
         if (platforms[i].start_row == -1) {
@@ -658,3 +720,65 @@ void build_frame(game_t *game, player_t *player)
         draw_enemy(game, &enemies[i]);
     }
 }
+
+
+void draw_hud(const game_t *game, const player_t *player)
+{
+    if (game == NULL) {
+        printf("Error(draw_hud): game_t pointer is NULL.\n");
+        assert(game);
+    }
+    if (player == NULL) {
+        printf("Error(draw_hud): player_t pointer is NULL.\n");
+        assert(player);
+    }
+    // Widgets of the head-up display, kept from one frame to the next
+    static const char coins_text[] = "COIN: ";
+    static hud_widget_t coins_text_widget = {
+        .text = {
+            .pos_x = 5,
+            .pos_y = 5,
+            .size = sizeof(coins_text),
+            .data = coins_text,
+            .color = BLACK,
+            .adaptive = 1,
+            .font = myFont
+        }
+    };
+    static hud_widget_t coins_widget = {
+        .text = {
+            .pos_x = 5 + sizeof(coins_text) * FONT_SIZE,
+            .pos_y = 5,
+            .color = BLACK,
+            .adaptive = 1,
+            .font = myFont
+        },
+        .num_digits = 3
+    };
+    static const char life_text[] = "LIFE: ";
+    static hud_widget_t life_text_widget = {
+        .text = {
+            .pos_x = LCD_WIDTH / 2,
+            .pos_y = 5,
+            .size = sizeof(life_text),
+            .data = life_text,
+            .color = BLACK,
+            .adaptive = 1,
+            .font = myFont
+        }
+    };
+    static hud_widget_t life_widget = {
+        .text = {
+            .pos_x = LCD_WIDTH / 2 + sizeof(life_text) * FONT_SIZE,
+            .pos_y = 5,
+            .color = BLACK,
+            .adaptive = 1,
+            .font = myFont
+        },
+        .num_digits = 3
+    };
+    st7735s_draw_widget(&coins_text_widget, 0);
+    st7735s_draw_widget(&life_text_widget, 0);
+    st7735s_draw_widget(&coins_widget, (uint8_t)game->coins + player->coins);
+    st7735s_draw_widget(&life_widget, (uint8_t)player->life);
+}
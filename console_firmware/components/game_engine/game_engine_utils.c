@@ -1,4 +1,5 @@
 #include "game_engine.h"
+#include "maps.h"
 #include "musics.h"
 
 
@@ -89,6 +90,8 @@ void reset_records(void)
         platforms[i].end_row = platforms[i].start_row;
         platforms[i].end_column = platforms[i].start_column;
     }
+    // Destroyed blocks are restored: the scenery shall be sent again
+    st7735s_invalidate_static_layer();
 }
 
 
@@ -183,3 +186,192 @@ uint8_t play_music(const game_t *game, music_t *music)
     }
     return 0;
 }
+
+
+/*************************************************
+ * Geometry
+ *************************************************/
+
+/**
+ * @brief Get the squared distance between two points.
+ * 
+ * @param dist_x Horizontal offset between the points, in pixels.
+ * @param dist_y Vertical offset between the points, in pixels.
+ * 
+ * @return Squared distance, up to 2^31.
+ */
+static uint32_t get_square_distance(const int16_t dist_x, const int16_t dist_y)
+{
+    return (uint32_t)((int32_t)dist_x * dist_x) + (uint32_t)((int32_t)dist_y * dist_y);
+}
+
+
+uint16_t get_distance(const int16_t dist_x, const int16_t dist_y)
+{
+    uint32_t square = get_square_distance(dist_x, dist_y);
+    // Square root computed bit by bit, from the highest power of 4 not above
+    // the square
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (square < bit) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (root + bit <= square) {
+            square -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+
+int8_t compare_distance(const int16_t dist_x, const int16_t dist_y, const uint16_t dist)
+{
+    const uint32_t square = get_square_distance(dist_x, dist_y);
+    const uint32_t dist_square = (uint32_t)dist * dist;
+    return (square < dist_square) ? -1 : (dist_square < square) ? 1 : 0;
+}
+
+
+/*************************************************
+ * Game loop
+ *************************************************/
+
+uint8_t play_frame(game_t *game, player_t *player, const game_input_t *input, music_t **cued_music)
+{
+    if (game == NULL) {
+        printf("Error(play_frame): game_t pointer is NULL.\n");
+        assert(game);
+    }
+    if (player == NULL) {
+        printf("Error(play_frame): player_t pointer is NULL.\n");
+        assert(player);
+    }
+    if (input == NULL) {
+        printf("Error(play_frame): game_input_t pointer is NULL.\n");
+        assert(input);
+    }
+    if (cued_music == NULL) {
+        printf("Error(play_frame): music_t pointer is NULL.\n");
+        assert(cued_music);
+    }
+    uint8_t events = 0;
+    // Compute all game parameters & objects
+    if (game->running) {
+        // Compute player
+        check_player_state(game, player, input->jump);
+        if (player->lightstaff && input->fire) {
+            *cued_music = &music_glamdring_blast;
+            player->power_used = 1;
+        }
+        update_player_position(game, player, input->axis_x);
+        if (check_block_collisions(game->map, &player->physics, cued_music, game->cam_row)) {
+            apply_reactive_force(&player->physics);
+        }
+        for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
+            update_platform_position(game, &platforms[i]);
+            if (check_platform_collision(&player->physics, &platforms[i])) {
+                player->physics.platform_i = i;
+                player->physics.pos_y -= player->physics.speed_y; // reactive force
+                // If moving, follow the movement of the platform
+                if (platforms[i].moved && platforms[i].horizontal) {
+                    player->physics.pos_x += platforms[i].physics.speed_x;
+                }
+                else if (platforms[i].moved && platforms[i].vertical) {
+                    player->physics.pos_y += platforms[i].physics.speed_y;
+                }
+            }
+        }
+        // Compute interactive blocks that have been hit by the player
+        for (uint8_t i = 0; i < NUM_BLOCK_RECORDS; i++) {
+            if (!blocks[i].is_hit || blocks[i].row == -1 || blocks[i].column == -1) {
+                continue;
+            }
+            compute_interactive_block(game, &blocks[i]);
+        }
+        // Compute items
+        for (uint8_t i = 0; i < NUM_ITEMS; i++) {
+            if (is_player_collecting_item(game, player, &items[i])) {
+                collect_item(player, &items[i]);
+            }
+        }
+        // Spawn & compute enemies
+        spawn_enemies(game->map, game->cam_pos_x, SPAWN_START(game->cam_row), SPAWN_END(game->cam_row) + 1);
+        for (int i = 0; i < NUM_ENEMY_RECORDS; i++) {
+            compute_enemy(game, player, &enemies[i], cued_music);
+        }
+        // Compute projectiles
+        for (uint8_t i = 0; i < MAX_PROJECTILES; i++) {
+            compute_projectile(game, player, &projectiles[i]);
+        }
+    }
+
+    // Play music
+    if (*cued_music != NULL && play_music(game, *cued_music)) {
+        *cued_music = NULL; // No more music to play for now
+    }
+
+    // Build the frame
+    build_frame(game, player);
+    draw_hud(game, player);
+    draw_player(game, player);
+
+    // Check & update game state
+    if (!game->running || game->map->end_row * BLOCK_SIZE < player->physics.pos_x) {
+        switch (game->map->id) {
+            case SHIRE:
+                game->running = 0;
+                if (transition_screen(BLACK, 1)) {
+                    game->init = 1;
+                    game->map = &map_moria;
+                    events |= MAP_COMPLETED;
+                }
+                break;
+            case MORIA:
+                game->running = 0;
+                if (player->physics.pos_x == game->map->start_row * BLOCK_SIZE) {
+                    if (transition_screen(BLACK, 0)) {
+                        game->running = 1;
+                    }
+                }
+                else if (transition_screen(WHITE, 1)) {
+                    game->over = 1;
+                    events |= GAME_COMPLETED;
+                }
+                break;
+        }
+    }
+    if (player->life == 0) {
+        game->over = 1;
+        events |= PLAYER_DEAD;
+    }
+    else if (game->reset) {
+        reset_game_flags(game);
+        reset_player(game, player);
+        reset_records();
+        load_platforms(game->map);
+        spawn_enemies(game->map, game->cam_pos_x, game->cam_row, game->cam_row + NUM_BLOCKS_X);
+        events |= PLAYER_RESET;
+    }
+    else if (game->init) {
+        game->coins             += player->coins;
+        player->coins           = 0;
+        player->physics.pos_x   = game->map->start_row * BLOCK_SIZE;
+        player->physics.pos_y   = (NUM_BLOCKS_Y - game->map->start_column - 1) * BLOCK_SIZE;
+        player->physics.speed_x = SPEED_INITIAL;
+        player->physics.speed_y = SPEED_INITIAL;
+        player->physics.falling = 0;
+        player->physics.jumping = 0;
+        reset_game_flags(game);
+        reset_records();
+        load_platforms(game->map);
+        spawn_enemies(game->map, game->cam_pos_x, game->cam_row, game->cam_row + NUM_BLOCKS_X);
+    }
+    reset_hit_flag_blocks();
+    return events;
+}
@@ -34,7 +34,7 @@
 #define NUM_ITEMS               10          // Maximum number of items on one frame.
 #define TIMESTEP_BUMP_COIN      10          // In milliseconds
 #define HEIGHT_BUMP_COIN        36          // Bump height of a coin, in pixels
-#define SHIELD_ALPHA            0.7         // Shield color transparency  
+#define SHIELD_ALPHA            (ALPHA_MAX * 7 / 10) // Shield color transparency
 // Player
 #define TIMESTEP_X              1           /* x-displacement delay in milliseconds
                                                Created for later use.*/
@@ -98,6 +98,26 @@ typedef struct {
     const map_t *map;
 } game_t;
 
+/**
+ * @brief Inputs of the player for one frame of the game.
+ */
+typedef struct {
+    uint8_t jump :          1;  // The jump button is pushed
+    uint8_t fire :          1;  // The fire button is pushed
+    int8_t axis_x;              // Post-processed value of the joystick x-axis
+} game_input_t;
+
+/**
+ * @brief Events of a frame of the game that the console acts upon, e.g.
+ * with a text or a delay. Returned as a mask by play_frame().
+ */
+typedef enum {
+    MAP_COMPLETED =             (1 << 0),   // The next map is loaded, after the fade in
+    GAME_COMPLETED =            (1 << 1),   // The last map is completed, after the fade in
+    PLAYER_DEAD =               (1 << 2),   // The player has no life left, the game is over
+    PLAYER_RESET =              (1 << 3)    // The player starts the map again
+} game_event_t;
+
 /**
  * @brief The physics_t object is used to work with dynamic elements which
  * must interact with their environment. An example of such use is the player's
@@ -340,6 +360,32 @@ void cue_music(music_t **music, block_t *block, const int8_t block_type);
  */
 uint8_t play_music(const game_t *game, music_t *music);
 
+/**
+ * @brief Get the distance between two points, rounded down to the pixel.
+ * 
+ * @param dist_x Horizontal offset between the points, in pixels.
+ * @param dist_y Vertical offset between the points, in pixels.
+ * 
+ * @return Distance in pixels, same as (uint16_t)hypot(dist_x, dist_y).
+ * 
+ * @note Integer square root, the ESP32 having no double-precision FPU.
+ */
+uint16_t get_distance(const int16_t dist_x, const int16_t dist_y);
+
+/**
+ * @brief Compare the distance between two points with a given distance.
+ * 
+ * @param dist_x Horizontal offset between the points, in pixels.
+ * @param dist_y Vertical offset between the points, in pixels.
+ * @param dist Distance to compare with, in pixels.
+ * 
+ * @return -1 if the points are closer than @p dist, 1 if they are further,
+ * else 0. Same as comparing hypot(dist_x, dist_y) with @p dist.
+ * 
+ * @note Compares the squared distances, without any square root.
+ */
+int8_t compare_distance(const int16_t dist_x, const int16_t dist_y, const uint16_t dist);
+
 
 /*************************************************
  * Item functions prototypes
@@ -433,6 +479,8 @@ void apply_reactive_force(physics_t *physics);
  * @param block Interative block to update.
  * 
  * @note Items are created and store in memory from this function.
+ * @note Blocks that get destroyed or bumped leave the static layer, whose
+ * area is invalidated (see st7735s_invalidate_layer()).
  */
 void compute_interactive_block(game_t *game, block_t *block);
 
@@ -626,5 +674,34 @@ void draw_player(const game_t *game, player_t *player);
  */
 void build_frame(game_t *game, player_t *player);
 
+/**
+ * @brief Draw the head-up display (coins and lives) on the frame.
+ * 
+ * @param game Game flags.
+ * @param player Player's character.
+ */
+void draw_hud(const game_t *game, const player_t *player);
+
+
+/*************************************************
+ * Game loop functions prototypes
+ *************************************************/
+
+/**
+ * @brief Compute and draw one frame of the game: everything between the
+ * reading of the inputs and st7735s_update_display().
+ * 
+ * @param[in, out] game Game flags. game->timer is to be set beforehand.
+ * @param[in, out] player Player's character.
+ * @param[in] input Inputs of the player.
+ * @param[in, out] cued_music Music to play, NULL if none.
+ * 
+ * @return Mask of the game_event_t of the frame, 0 if none.
+ * 
+ * @note Both the console and the host benchmark run the game through it,
+ * so that the benchmark follows the frames of the console.
+ */
+uint8_t play_frame(game_t *game, player_t *player, const game_input_t *input, music_t **cued_music);
+
 
 #endif // __GAME_ENGINE_H__
\ No newline at end of file
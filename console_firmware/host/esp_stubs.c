@@ -0,0 +1,266 @@
+/**
+ * @file esp_stubs.c
+ * @brief Host stand-ins of the ESP-IDF and FreeRTOS functions used by the
+ * console components, other than the display bus (see st7735s_emulator.c).
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "rom/ets_sys.h"
+#include "driver/gpio.h"
+#include "driver/ledc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+
+/**
+ * @brief Binary semaphore. It is never waited for on the host.
+ */
+struct semaphore {
+    uint8_t given;
+};
+
+/**
+ * @brief Periodic timer. It is never fired on the host.
+ */
+struct esp_timer {
+    esp_timer_create_args_t args;
+    uint64_t period;
+};
+
+
+#define NUM_SEMAPHORES      (8)
+#define NUM_TIMERS          (8)
+
+static struct semaphore semaphores[NUM_SEMAPHORES];
+static uint8_t num_semaphores = 0;
+static struct esp_timer timers[NUM_TIMERS];
+static uint8_t num_timers = 0;
+static uint32_t random_state = 12345;
+static size_t heap_limit = SIZE_MAX;    // Bytes heap_caps_calloc() can still allocate
+
+
+/*************************************************
+ * System
+ *************************************************/
+
+uint32_t esp_random(void)
+{
+    // Linear congruential generator, seeded identically on each run
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+
+int64_t esp_timer_get_time(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args,
+                           esp_timer_handle_t *out_handle)
+{
+    if (num_timers >= NUM_TIMERS) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timers[num_timers].args = *create_args;
+    *out_handle = &timers[num_timers++];
+    return ESP_OK;
+}
+
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    timer->period = period;
+    return ESP_OK;
+}
+
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    timer->period = 0;
+    return ESP_OK;
+}
+
+
+void ets_delay_us(uint32_t us)
+{
+    (void)us;
+}
+
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void)caps;
+    if (size && heap_limit / size < n) {
+        return NULL;
+    }
+    if (heap_limit != SIZE_MAX) {
+        heap_limit -= n * size;
+    }
+    return calloc(n, size);
+}
+
+
+void esp_stubs_set_heap_limit(const size_t bytes)
+{
+    heap_limit = bytes;
+}
+
+
+/*************************************************
+ * FreeRTOS
+ *************************************************/
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name,
+                       const uint32_t stack_depth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created_task)
+{
+    if (created_task != NULL) {
+        *created_task = NULL;
+    }
+    task_code(parameters);
+    return pdPASS;
+}
+
+
+void vTaskDelete(TaskHandle_t task)
+{
+    (void)task;
+}
+
+
+void vTaskDelay(const TickType_t ticks)
+{
+    (void)ticks;
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    if (num_semaphores >= NUM_SEMAPHORES) {
+        return NULL;
+    }
+    semaphores[num_semaphores].given = 0;
+    return &semaphores[num_semaphores++];
+}
+
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    semaphore->given = 0;
+    return pdTRUE;
+}
+
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore->given) {
+        return pdFALSE;
+    }
+    semaphore->given = 1;
+    return pdTRUE;
+}
+
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore,
+                                 BaseType_t *higher_priority_task_woken)
+{
+    if (higher_priority_task_woken != NULL) {
+        *higher_priority_task_woken = pdFALSE;
+    }
+    return xSemaphoreGive(semaphore);
+}
+
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    (void)semaphore;
+}
+
+
+/*************************************************
+ * GPIO (see st7735s_emulator.c for gpio_set_level())
+ *************************************************/
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    return ESP_OK;
+}
+
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    return 1;
+}
+
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t gpio_set_pull_mode(gpio_num_t gpio_num, gpio_pull_mode_t pull)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler,
+                               void *args)
+{
+    return ESP_OK;
+}
+
+
+/*************************************************
+ * LED PWM controller (buzzer)
+ *************************************************/
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t *timer_conf)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t *ledc_conf)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t ledc_set_duty(ledc_mode_t speed_mode, ledc_channel_t channel,
+                        uint32_t duty)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t ledc_set_freq(ledc_mode_t speed_mode, ledc_timer_t timer_num,
+                        uint32_t freq_hz)
+{
+    return ESP_OK;
+}
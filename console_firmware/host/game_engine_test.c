@@ -0,0 +1,207 @@
+/**
+ * @file game_engine_test.c
+ * @brief Host test of the integer geometry of the game engine. Checks
+ * get_distance() and compare_distance() against the double-precision
+ * expressions they replace, and optionally times both.
+ *
+ * Usage: game_engine_test [-b]
+ *  -b  Also time the integer and double-precision versions.
+ *
+ * @note The timings are those of the host, whose FPU computes in double
+ * precision. On the ESP32, the double-precision versions go through the
+ * soft-float library instead.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "game_engine.h"
+
+#define RANGE               (3 * LCD_WIDTH / 4)     // As in game_engine_char.c
+#define MAX_SPELL_RADIUS    (1024)
+#define SWEEP_STEP          (31)
+#define BENCHMARK_CALLS     (10000000)
+
+
+static uint32_t failures = 0;
+
+
+/**
+ * @brief Report a mismatch, up to 10 of them.
+ */
+static void fail(const char *test, const int32_t dist_x, const int32_t dist_y,
+                 const int32_t dist, const int32_t expected, const int32_t result)
+{
+    if (failures++ < 10) {
+        printf("Error(%s): (%ld, %ld, %ld) gives %ld, expected %ld.\n", test,
+               (long)dist_x, (long)dist_y, (long)dist, (long)result, (long)expected);
+    }
+}
+
+
+/**
+ * @brief Offsets along one axis of the sweep over the whole int16 range,
+ * the bounds included.
+ */
+static int32_t next_sweep(const int32_t dist)
+{
+    if (dist == INT16_MAX) {
+        return INT16_MAX + 1;
+    }
+    return (INT16_MAX - SWEEP_STEP < dist) ? INT16_MAX : dist + SWEEP_STEP;
+}
+
+
+static void check_distance(const int32_t dist_x, const int32_t dist_y)
+{
+    const uint16_t expected = hypot(abs(dist_x), abs(dist_y));
+    const uint16_t result = get_distance(dist_x, dist_y);
+    if (result != expected) {
+        fail("get_distance", dist_x, dist_y, 0, expected, result);
+    }
+}
+
+
+/**
+ * @brief get_distance() against (uint16_t)hypot(), as in is_on_sight():
+ * every offset along the x-axis with the vertical offsets of the map, and
+ * a sweep of the whole int16 range on both axes.
+ */
+static void test_get_distance(void)
+{
+    for (int32_t dist_x = INT16_MIN; dist_x <= INT16_MAX; dist_x++) {
+        for (int32_t dist_y = -LCD_HEIGHT; dist_y <= LCD_HEIGHT; dist_y++) {
+            check_distance(dist_x, dist_y);
+        }
+    }
+    for (int32_t dist_x = INT16_MIN; dist_x <= INT16_MAX; dist_x = next_sweep(dist_x)) {
+        for (int32_t dist_y = INT16_MIN; dist_y <= INT16_MAX; dist_y = next_sweep(dist_y)) {
+            check_distance(dist_x, dist_y);
+        }
+    }
+}
+
+
+static void check_comparison(const int32_t dist_x, const int32_t dist_y, const uint16_t dist)
+{
+    const double distance = hypot(dist_x, dist_y);
+    const int8_t expected = (distance < dist) ? -1 : (dist < distance) ? 1 : 0;
+    const int8_t result = compare_distance(dist_x, dist_y, dist);
+    if (result != expected) {
+        fail("compare_distance", dist_x, dist_y, dist, expected, result);
+    }
+}
+
+
+/**
+ * @brief compare_distance() against the comparisons of hypot() it replaces:
+ * the range of the projectiles in shoot_projectile(), with the absolute
+ * offsets of two positions, and the radius of the spell in compute_enemy(),
+ * with offsets truncated to 8 bits.
+ */
+static void test_compare_distance(void)
+{
+    for (int32_t dist_x = 0; dist_x <= INT16_MAX; dist_x++) {
+        for (int32_t dist_y = 0; dist_y <= 2 * RANGE; dist_y++) {
+            const uint8_t expected = (RANGE < hypot((uint16_t)dist_x, (uint16_t)dist_y));
+            const uint8_t result = (0 < compare_distance(dist_x, dist_y, RANGE));
+            if (result != expected) {
+                fail("compare_distance", dist_x, dist_y, RANGE, expected, result);
+            }
+        }
+    }
+    for (int32_t dist_x = 0; dist_x <= UINT8_MAX; dist_x++) {
+        for (int32_t dist_y = 0; dist_y <= UINT8_MAX; dist_y++) {
+            const double distance = hypot((uint8_t)dist_x, (uint8_t)dist_y);
+            for (uint16_t radius = 0; radius <= MAX_SPELL_RADIUS; radius++) {
+                const uint8_t expected = (distance < radius);
+                const uint8_t result = (compare_distance(dist_x, dist_y, radius) < 0);
+                if (result != expected) {
+                    fail("compare_distance", dist_x, dist_y, radius, expected, result);
+                }
+            }
+        }
+    }
+    // Every outcome, over the whole int16 range
+    for (int32_t dist_x = INT16_MIN; dist_x <= INT16_MAX; dist_x = next_sweep(dist_x)) {
+        for (int32_t dist_y = INT16_MIN; dist_y <= INT16_MAX; dist_y = next_sweep(dist_y)) {
+            const uint16_t distance = get_distance(dist_x, dist_y);
+            check_comparison(dist_x, dist_y, distance);
+            check_comparison(dist_x, dist_y, distance + 1);
+            if (distance) {
+                check_comparison(dist_x, dist_y, distance - 1);
+            }
+        }
+    }
+}
+
+
+static int64_t get_time_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Time the integer and double-precision versions over the offsets
+ * of the screen, in nanoseconds per call.
+ */
+static void benchmark(void)
+{
+    volatile uint32_t sink = 0;
+    int64_t start = get_time_ns();
+    for (int32_t i = 0; i < BENCHMARK_CALLS; i++) {
+        sink += (uint16_t)hypot(abs(i % LCD_WIDTH - LCD_WIDTH / 2), abs(i % LCD_HEIGHT - LCD_HEIGHT / 2));
+    }
+    const int64_t hypot_ns = get_time_ns() - start;
+    start = get_time_ns();
+    for (int32_t i = 0; i < BENCHMARK_CALLS; i++) {
+        sink += get_distance(i % LCD_WIDTH - LCD_WIDTH / 2, i % LCD_HEIGHT - LCD_HEIGHT / 2);
+    }
+    const int64_t distance_ns = get_time_ns() - start;
+    start = get_time_ns();
+    for (int32_t i = 0; i < BENCHMARK_CALLS; i++) {
+        sink += (RANGE < hypot(i % LCD_WIDTH, i % LCD_HEIGHT));
+    }
+    const int64_t hypot_compare_ns = get_time_ns() - start;
+    start = get_time_ns();
+    for (int32_t i = 0; i < BENCHMARK_CALLS; i++) {
+        sink += (0 < compare_distance(i % LCD_WIDTH, i % LCD_HEIGHT, RANGE));
+    }
+    const int64_t compare_ns = get_time_ns() - start;
+    printf("(uint16_t)hypot    %.2f ns/call\n", (double)hypot_ns / BENCHMARK_CALLS);
+    printf("get_distance       %.2f ns/call\n", (double)distance_ns / BENCHMARK_CALLS);
+    printf("hypot < range      %.2f ns/call\n", (double)hypot_compare_ns / BENCHMARK_CALLS);
+    printf("compare_distance   %.2f ns/call\n", (double)compare_ns / BENCHMARK_CALLS);
+}
+
+
+int main(int argc, char *argv[])
+{
+    uint8_t timed = 0;
+    int option;
+    while ((option = getopt(argc, argv, "b")) != -1) {
+        if (option == 'b') {
+            timed = 1;
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-b]\n", argv[0]);
+            return 2;
+        }
+    }
+    test_get_distance();
+    test_compare_distance();
+    if (failures) {
+        printf("%lu mismatches\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("get_distance and compare_distance match the double-precision versions\n");
+    if (timed) {
+        benchmark();
+    }
+    return 0;
+}
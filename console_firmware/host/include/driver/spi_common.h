@@ -0,0 +1,48 @@
+/**
+ * @file spi_common.h
+ * @brief Host stand-in for the ESP-IDF SPI bus definitions.
+ */
+
+#ifndef __HOST_DRIVER_SPI_COMMON_H__
+#define __HOST_DRIVER_SPI_COMMON_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+
+#define SPI_SWAP_DATA_TX(DATA, LEN) \
+    (__builtin_bswap32((uint32_t)(DATA) << (32 - (LEN))))
+
+typedef enum {
+    SPI1_HOST = 0,
+    SPI2_HOST = 1,
+    SPI3_HOST = 2
+} spi_host_device_t;
+
+#define HSPI_HOST           SPI2_HOST
+#define VSPI_HOST           SPI3_HOST
+
+typedef enum {
+    SPI_DMA_DISABLED = 0,
+    SPI_DMA_CH1 = 1,
+    SPI_DMA_CH2 = 2,
+    SPI_DMA_CH_AUTO = 3
+} spi_common_dma_t;
+
+typedef struct {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+    uint32_t flags;
+    int intr_flags;
+} spi_bus_config_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id,
+                             const spi_bus_config_t *bus_config,
+                             spi_common_dma_t dma_chan);
+
+#endif // __HOST_DRIVER_SPI_COMMON_H__
@@ -0,0 +1,14 @@
+/**
+ * @file esp_attr.h
+ * @brief Host stand-in for the ESP-IDF memory placement attributes.
+ */
+
+#ifndef __HOST_ESP_ATTR_H__
+#define __HOST_ESP_ATTR_H__
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define DMA_ATTR
+#define WORD_ALIGNED_ATTR   __attribute__((aligned(4)))
+
+#endif // __HOST_ESP_ATTR_H__
@@ -0,0 +1,29 @@
+/**
+ * @file esp_err.h
+ * @brief Host stand-in for the ESP-IDF error codes.
+ */
+
+#ifndef __HOST_ESP_ERR_H__
+#define __HOST_ESP_ERR_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK                  (0)
+#define ESP_FAIL                (-1)
+#define ESP_ERR_INVALID_ARG     (0x102)
+#define ESP_ERR_INVALID_STATE   (0x103)
+#define ESP_ERR_TIMEOUT         (0x107)
+
+#define ESP_ERROR_CHECK(x) do {                                             \
+        esp_err_t err_rc_ = (x);                                            \
+        if (err_rc_ != ESP_OK) {                                            \
+            printf("Error(%s): ESP_ERROR_CHECK failed (%d) at %s:%d\n",     \
+                   __func__, err_rc_, __FILE__, __LINE__);                  \
+            abort();                                                        \
+        }                                                                   \
+    } while (0)
+
+#endif // __HOST_ESP_ERR_H__
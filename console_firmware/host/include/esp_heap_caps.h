@@ -0,0 +1,25 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief Host stand-in for the ESP-IDF heap allocator. The capabilities
+ * are ignored, and the heap can be limited to emulate a target running out
+ * of memory.
+ */
+
+#ifndef __HOST_ESP_HEAP_CAPS_H__
+#define __HOST_ESP_HEAP_CAPS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+
+/**
+ * @brief Limit the bytes that heap_caps_calloc() can allocate in total,
+ * SIZE_MAX (default) for no limit. Host only.
+ */
+void esp_stubs_set_heap_limit(const size_t bytes);
+
+#endif // __HOST_ESP_HEAP_CAPS_H__
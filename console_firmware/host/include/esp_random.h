@@ -0,0 +1,14 @@
+/**
+ * @file esp_random.h
+ * @brief Host stand-in for the ESP-IDF random number generator. The
+ * sequence is deterministic, so that runs can be compared.
+ */
+
+#ifndef __HOST_ESP_RANDOM_H__
+#define __HOST_ESP_RANDOM_H__
+
+#include <stdint.h>
+
+uint32_t esp_random(void);
+
+#endif // __HOST_ESP_RANDOM_H__
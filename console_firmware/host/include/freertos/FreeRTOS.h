@@ -0,0 +1,26 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Host stand-in for the FreeRTOS base types.
+ */
+
+#ifndef __HOST_FREERTOS_H__
+#define __HOST_FREERTOS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define configTICK_RATE_HZ      (100)
+#define portTICK_PERIOD_MS      (1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY           (0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms) / portTICK_PERIOD_MS)
+#define pdFALSE                 (0)
+#define pdTRUE                  (1)
+#define pdFAIL                  (pdFALSE)
+#define pdPASS                  (pdTRUE)
+#define portYIELD_FROM_ISR(x)   ((void)(x))
+
+#endif // __HOST_FREERTOS_H__
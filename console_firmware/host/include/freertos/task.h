@@ -0,0 +1,21 @@
+/**
+ * @file task.h
+ * @brief Host stand-in for the FreeRTOS tasks. A created task runs to
+ * completion within xTaskCreate().
+ */
+
+#ifndef __HOST_FREERTOS_TASK_H__
+#define __HOST_FREERTOS_TASK_H__
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name,
+                       const uint32_t stack_depth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created_task);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(const TickType_t ticks);
+
+#endif // __HOST_FREERTOS_TASK_H__
@@ -0,0 +1,13 @@
+/**
+ * @file ets_sys.h
+ * @brief Host stand-in for the ROM delay function.
+ */
+
+#ifndef __HOST_ETS_SYS_H__
+#define __HOST_ETS_SYS_H__
+
+#include <stdint.h>
+
+void ets_delay_us(uint32_t us);
+
+#endif // __HOST_ETS_SYS_H__
@@ -0,0 +1,100 @@
+/**
+ * @file st7735s_emulator.h
+ * @brief Host emulation of the ST7735S display controller, behind the
+ * ESP-IDF spi_master and gpio API used by the ST7735S driver.
+ *
+ * @note The emulated controller decodes the commands sent by the driver
+ * (CASET, RASET, RAMWR, MADCTL, COLMOD, VSCRDEF, VSCSAD...) into its display
+ * memory, and counts the traffic of the SPI bus. The panel is viewed in the
+ * landscape orientation of the console: gate line 0 on the right.
+ * @note Queued transactions are executed when their result is retrieved
+ * (spi_device_get_trans_result()), so that a buffer modified while its
+ * transaction is in flight shows up on the emulated display.
+ */
+
+#ifndef __ST7735S_EMULATOR_H__
+#define __ST7735S_EMULATOR_H__
+
+
+#include <stdint.h>
+
+
+/*************************************************
+ * Emulated display parameters
+ *************************************************/
+#define EMU_PIN_DC          (15)        // D/C pin of the display (see PIN_LCD_DC)
+#define EMU_GRAM_WIDTH      (128)       // Number of source lines (memory columns)
+#define EMU_GRAM_HEIGHT     (160)       // Number of gate lines (memory rows)
+#define EMU_VIEW_WIDTH      (EMU_GRAM_HEIGHT)   // Landscape view, in pixel
+#define EMU_VIEW_HEIGHT     (EMU_GRAM_WIDTH)    // Landscape view, in pixel
+
+
+/*************************************************
+ * Data structures
+ *************************************************/
+
+/**
+ * @brief Traffic counters of the emulated SPI bus, accumulated since the
+ * last call of st7735s_emu_reset_stats().
+ */
+typedef struct {
+    uint32_t transactions;  // Executed SPI transactions
+    uint32_t queued;        // Transactions queued with spi_device_queue_trans()
+    uint32_t polled;        // Transactions sent with spi_device_polling_transmit()
+    uint32_t bytes;         // Bytes sent on the bus
+    uint32_t commands;      // Command bytes (D/C low)
+    uint32_t ramwr;         // Memory write commands (RAMWR)
+    uint32_t pixels;        // Pixels written to the display memory
+    uint32_t dc_toggles;    // Level changes of the D/C line
+    uint32_t scrolls;       // Scroll start address changes (VSCSAD)
+    uint64_t bus_ns;        // Time spent by the data on the bus, in ns
+} emu_stats_t;
+
+
+/*************************************************
+ * Prototypes
+ *************************************************/
+
+/**
+ * @brief Copy the traffic counters of the emulated bus.
+ *
+ * @param[out] stats Pointer to the structure to fill.
+ */
+void st7735s_emu_get_stats(emu_stats_t *stats);
+
+/**
+ * @brief Reset the traffic counters of the emulated bus, e.g. at the start
+ * of a frame.
+ */
+void st7735s_emu_reset_stats(void);
+
+/**
+ * @brief Get a pixel as displayed by the panel, scroll and inversion
+ * included.
+ *
+ * @param[in] x Landscape x-position, from 0 to EMU_VIEW_WIDTH - 1.
+ * @param[in] y Landscape y-position, from 0 to EMU_VIEW_HEIGHT - 1.
+ * @return RGB565 color of the pixel (not byte-swapped).
+ */
+uint16_t st7735s_emu_get_pixel(const uint8_t x, const uint8_t y);
+
+/**
+ * @brief Compute a hash (FNV-1a) of the displayed image.
+ *
+ * @param[in] mask Mask applied to each RGB565 pixel before hashing, e.g.
+ * 0xF79E to compare images sent in the 12-bit color format with images
+ * sent in the 16-bit color format.
+ * @return Hash of the displayed image.
+ */
+uint32_t st7735s_emu_hash(const uint16_t mask);
+
+/**
+ * @brief Write the displayed image to a binary PPM file.
+ *
+ * @param[in] path Path of the file to write.
+ * @return 0 on success, -1 if the file cannot be written.
+ */
+int st7735s_emu_dump_ppm(const char *path);
+
+
+#endif // __ST7735S_EMULATOR_H__
@@ -0,0 +1,261 @@
+/**
+ * @file st7735s_benchmark.c
+ * @brief Host benchmark of the display path. Replays the game with scripted
+ * inputs on the emulated ST7735S (see st7735s_emulator.h), and prints the
+ * traffic of the SPI bus and a hash of the displayed image for each frame.
+ *
+ * Usage: st7735s_benchmark [-n frames] [-m shire|moria] [-c 12|16|auto]
+ *                          [-d prefix] [-e every] [-H bytes] [-q]
+ *  -n  Number of game frames to run (default 600).
+ *  -m  Map on which the game starts (default shire).
+ *  -c  Color format of the transfers. auto switches to 12-bit during the
+ *      transitions, as the firmware does (default auto).
+ *  -d  Dump the displayed image as <prefix>_<frame>.ppm.
+ *  -e  Dump every given number of frames (default 50).
+ *  -H  Heap available to the driver, in bytes, e.g. 0 to run it with the
+ *      buffers it can allocate missing (default unlimited).
+ *  -q  Only print the totals.
+ *
+ * @note The hash of a frame only depends on the displayed image: two
+ * versions of the display path can be compared frame by frame with
+ * `cut -d' ' -f1-3`. Use -c 16 on both sides if one of them changes the
+ * color depth of the transfers.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_heap_caps.h"
+
+#include "st7735s_hal.h"
+#include "st7735s_graphics.h"
+#include "game_engine.h"
+#include "st7735s_emulator.h"
+// Assets
+#include "fonts.h"
+#include "maps.h"
+#include "sprites.h"
+#include "musics.h"
+
+#define REFRESH_RATE        35
+#define FRAME_PERIOD_MS     (1000 / REFRESH_RATE)
+#define MENU_FRAMES         3
+#define COLOR_FORMAT_AUTO   (0)
+
+
+/**
+ * @brief Totals of the bus traffic over the benchmark.
+ */
+typedef struct {
+    uint32_t frames;
+    uint64_t transactions;
+    uint64_t bytes;
+    uint64_t dc_toggles;
+    uint64_t pixels;
+    uint64_t bus_ns;
+    uint32_t polled;
+} totals_t;
+
+
+static totals_t totals;
+static uint8_t quiet = 0;
+static uint8_t color_format = COLOR_FORMAT_AUTO;
+static const char *dump_prefix = NULL;
+static int dump_every = 50;
+
+
+/**
+ * @brief Send the frame to the emulated display, wait for the transfer and
+ * report its traffic.
+ *
+ * @param[in] handle SPI device handle of the display.
+ * @param[in] label Label of the frame in the report.
+ * @param[in] index Index of the frame in the report.
+ */
+static void present(const spi_device_handle_t handle, const char *label, const int index)
+{
+    emu_stats_t stats;
+    st7735s_emu_reset_stats();
+    st7735s_update_display(handle);
+    st7735s_wait_frame(handle);
+    st7735s_emu_get_stats(&stats);
+
+    totals.frames++;
+    totals.transactions += stats.transactions;
+    totals.bytes += stats.bytes;
+    totals.dc_toggles += stats.dc_toggles;
+    totals.pixels += stats.pixels;
+    totals.bus_ns += stats.bus_ns;
+    totals.polled += stats.polled;
+    if (!quiet) {
+        printf("%s %d %08x tx %u bytes %u dc %u px %u scroll %u bus_us %u\n",
+               label, index, st7735s_emu_hash(0xFFFF), stats.transactions, stats.bytes,
+               stats.dc_toggles, stats.pixels, stats.scrolls, (uint32_t)(stats.bus_ns / 1000));
+    }
+    if (dump_prefix != NULL && index % dump_every == 0) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s_%s_%04d.ppm", dump_prefix, label, index);
+        st7735s_emu_dump_ppm(path);
+    }
+}
+
+
+/**
+ * @brief Scripted gamepad: walk forward with regular jumps, pause, and
+ * fire the light staff from time to time.
+ */
+static int8_t script_axis(const int frame_index)
+{
+    return (frame_index % 200) < 150 ? 1 : 0;
+}
+
+static uint8_t script_jump(const int frame_index)
+{
+    return (frame_index % 37) < 3;
+}
+
+static uint8_t script_fire(const int frame_index)
+{
+    return (frame_index % 250) == 100;
+}
+
+
+int main(int argc, char **argv)
+{
+    int num_frames = 600;
+    const map_t *start_map = &map_shire;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:m:c:d:e:H:q")) != -1) {
+        switch (opt) {
+            case 'n':
+                num_frames = atoi(optarg);
+                break;
+            case 'm':
+                start_map = strcmp(optarg, "moria") ? &map_shire : &map_moria;
+                break;
+            case 'c':
+                color_format = !strcmp(optarg, "12") ? LCD_COLOR_FORMAT_12 :
+                               !strcmp(optarg, "16") ? LCD_COLOR_FORMAT_16 : COLOR_FORMAT_AUTO;
+                break;
+            case 'd':
+                dump_prefix = optarg;
+                break;
+            case 'e':
+                dump_every = atoi(optarg) > 0 ? atoi(optarg) : 1;
+                break;
+            case 'H':
+                esp_stubs_set_heap_limit(strtoul(optarg, NULL, 0));
+                break;
+            case 'q':
+                quiet = 1;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n frames] [-m shire|moria] [-c 12|16|auto] "
+                        "[-d prefix] [-e every] [-H bytes] [-q]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    spi_device_handle_t tft_handle;
+    st7735s_init_spi(&tft_handle);
+    st7735s_init_tft(tft_handle);
+    st7735s_set_frame_rate(tft_handle, REFRESH_RATE);
+    if (color_format != COLOR_FORMAT_AUTO) {
+        st7735s_set_color_format(tft_handle, color_format);
+    }
+    st7735s_fill_background(BLACK);
+    present(tft_handle, "init", 0);
+
+    game_t game = {
+        .running = 1,
+        .map = start_map
+    };
+    reset_records();
+    load_platforms(game.map);
+    spawn_enemies(game.map, game.cam_pos_x, game.cam_row, game.cam_row + NUM_BLOCKS_X + 1);
+    music_t *cued_music = NULL;
+    // Enough lives for the script to go through both maps
+    player_t player = {
+        .life               = 9,
+        .forward            = 1,
+        .physics.platform_i = -1,
+        .physics.pos_x      = game.map->start_row * BLOCK_SIZE,
+        .physics.pos_y      = (NUM_BLOCKS_Y - game.map->start_column - 1) * BLOCK_SIZE,
+        .physics.speed_x    = SPEED_INITIAL,
+        .physics.speed_y    = SPEED_INITIAL,
+        .sprite.height      = BLOCK_SIZE,
+        .sprite.width       = BLOCK_SIZE,
+        .sprite.indexed     = &sprite_player
+    };
+
+    // Start menu
+    for (int i = 0; i < MENU_FRAMES; i++) {
+        st7735s_fill_background(BLACK);
+        const char menu_txt1[] = "THE LORD OF\nTHE FAKE RING";
+        const text_t menu_txt1_obj = {
+            .color = ORANGE,
+            .pos_x = 30,
+            .pos_y = 40,
+            .font = myFont,
+            .data = menu_txt1,
+            .size = sizeof(menu_txt1)
+        };
+        st7735s_draw_text(&menu_txt1_obj);
+        const char menu_txt2[] = "PRESS 'A' TO PLAY";
+        const text_t menu_txt2_obj = {
+            .color = GREY,
+            .pos_x = 20,
+            .pos_y = LCD_HEIGHT - 30,
+            .font = myFont,
+            .data = menu_txt2,
+            .size = sizeof(menu_txt2)
+        };
+        st7735s_draw_text(&menu_txt2_obj);
+        present(tft_handle, "menu", i);
+    }
+    memset(&totals, 0, sizeof(totals));
+
+    /* Game loop, as in app_main(): play_frame() with the gamepad replaced by
+     the script. The texts and delays of the transitions are skipped. */
+    const int64_t start_time = esp_timer_get_time();
+    for (int frame_index = 0; frame_index < num_frames && !game.over; frame_index++) {
+        game.timer += FRAME_PERIOD_MS;
+        if (frame_index == 40) {
+            player.lightstaff = 1;
+        }
+        if (frame_index >= 60) {
+            player.shield = 1;
+        }
+        const game_input_t input = {
+            .jump   = script_jump(frame_index),
+            .fire   = script_fire(frame_index),
+            .axis_x = script_axis(frame_index)
+        };
+        play_frame(&game, &player, &input, &cued_music);
+
+        if (color_format == COLOR_FORMAT_AUTO) {
+            st7735s_set_color_format(tft_handle, game.running ? LCD_COLOR_FORMAT_16 : LCD_COLOR_FORMAT_12);
+        }
+        present(tft_handle, "frame", frame_index);
+    }
+    const int64_t elapsed = esp_timer_get_time() - start_time;
+
+    if (totals.frames == 0) {
+        return EXIT_SUCCESS;
+    }
+    printf("frames %u\n", totals.frames);
+    printf("bytes %llu (%llu per frame)\n", (unsigned long long)totals.bytes,
+           (unsigned long long)(totals.bytes / totals.frames));
+    printf("transactions %llu (%llu per frame), polled %u\n", (unsigned long long)totals.transactions,
+           (unsigned long long)(totals.transactions / totals.frames), totals.polled);
+    printf("dc_toggles %llu (%llu per frame)\n", (unsigned long long)totals.dc_toggles,
+           (unsigned long long)(totals.dc_toggles / totals.frames));
+    printf("pixels %llu (%llu per frame)\n", (unsigned long long)totals.pixels,
+           (unsigned long long)(totals.pixels / totals.frames));
+    printf("bus_us %llu per frame at %d Hz SPI clock\n",
+           (unsigned long long)(totals.bus_ns / totals.frames / 1000), SPI_LCD_FREQUENCY);
+    printf("host_us %lld per frame\n", (long long)(elapsed / totals.frames));
+    return EXIT_SUCCESS;
+}
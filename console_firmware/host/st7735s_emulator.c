@@ -0,0 +1,515 @@
+#include "st7735s_emulator.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+
+
+/*************************************************
+ * ST7735S commands decoded by the emulator
+ *************************************************/
+#define EMU_SWRESET         (0x01)
+#define EMU_DISPOFF         (0x28)
+#define EMU_DISPON          (0x29)
+#define EMU_INVOFF          (0x20)
+#define EMU_INVON           (0x21)
+#define EMU_CASET           (0x2A)
+#define EMU_RASET           (0x2B)
+#define EMU_RAMWR           (0x2C)
+#define EMU_VSCRDEF         (0x33)
+#define EMU_TEOFF           (0x34)
+#define EMU_TEON            (0x35)
+#define EMU_MADCTL          (0x36)
+#define EMU_VSCSAD          (0x37)
+#define EMU_COLMOD          (0x3A)
+
+#define EMU_MADCTL_MY       (1 << 7)
+#define EMU_MADCTL_MX       (1 << 6)
+#define EMU_MADCTL_MV       (1 << 5)
+#define EMU_MADCTL_BGR      (1 << 3)
+
+#define EMU_MAX_PARAMETERS  (16)
+#define EMU_MAX_QSIZE       (256)       // Maximum queue size of the emulated device
+#define EMU_DMA_TRANSFER    (4092)      // Maximum transfer size with DMA, in bytes
+#define EMU_CPU_TRANSFER    (64)        // Maximum transfer size without DMA, in bytes
+
+
+/**
+ * @brief Emulated SPI device, i.e. the ST7735S controller.
+ */
+struct spi_device_t {
+    int clock_speed_hz;
+    int queue_size;
+    transaction_cb_t pre_cb;
+    transaction_cb_t post_cb;
+    spi_transaction_t *queue[EMU_MAX_QSIZE];
+    uint16_t first;                     // Oldest transaction in flight
+    uint16_t in_flight;                 // Number of transactions in flight
+};
+
+
+static struct spi_device_t device;
+static size_t max_transfer_size = EMU_DMA_TRANSFER;
+static emu_stats_t stats;
+static uint8_t dc_level = 0;
+
+// Display memory, in RGB565
+static uint16_t gram[EMU_GRAM_HEIGHT][EMU_GRAM_WIDTH];
+// Controller registers
+static uint8_t command = 0x00;
+static uint8_t parameters[EMU_MAX_PARAMETERS];
+static uint8_t num_parameters = 0;
+static uint8_t madctl = 0x00;
+static uint8_t colmod = 0x06;
+static uint8_t inverted = 0;
+static uint8_t display_on = 0;
+static uint8_t te_on = 0;
+static uint16_t column_start = 0, column_end = EMU_GRAM_WIDTH - 1;
+static uint16_t row_start = 0, row_end = EMU_GRAM_HEIGHT - 1;
+static uint16_t tfa = 0, vsa = EMU_GRAM_HEIGHT, bfa = 0, ssa = 0;
+// Memory write state
+static uint8_t writing = 0;
+static uint16_t column = 0, row = 0;
+static uint8_t pixel_bytes[3];
+static uint8_t num_pixel_bytes = 0;
+
+
+/**
+ * @brief Reset the registers of the controller (SWRESET).
+ */
+static void reset_controller(void)
+{
+    madctl = 0x00;
+    colmod = 0x06;
+    inverted = 0;
+    display_on = 0;
+    te_on = 0;
+    column_start = 0;
+    column_end = EMU_GRAM_WIDTH - 1;
+    row_start = 0;
+    row_end = EMU_GRAM_HEIGHT - 1;
+    tfa = 0;
+    vsa = EMU_GRAM_HEIGHT;
+    bfa = 0;
+    ssa = 0;
+    writing = 0;
+}
+
+
+/**
+ * @brief Write a pixel at the address counter, and increment it within the
+ * window set by CASET and RASET.
+ *
+ * @param[in] color RGB565 color of the pixel.
+ */
+static void write_pixel(const uint16_t color)
+{
+    uint16_t gate, source;
+    if (madctl & EMU_MADCTL_MV) {
+        // Row/column exchange: the columns address the gate lines
+        gate = (madctl & EMU_MADCTL_MX) ? EMU_GRAM_HEIGHT - 1 - column : column;
+        source = (madctl & EMU_MADCTL_MY) ? EMU_GRAM_WIDTH - 1 - row : row;
+    }
+    else {
+        gate = (madctl & EMU_MADCTL_MY) ? EMU_GRAM_HEIGHT - 1 - row : row;
+        source = (madctl & EMU_MADCTL_MX) ? EMU_GRAM_WIDTH - 1 - column : column;
+    }
+    if (gate < EMU_GRAM_HEIGHT && source < EMU_GRAM_WIDTH) {
+        gram[gate][source] = color;
+    }
+    stats.pixels++;
+    if (++column > column_end) {
+        column = column_start;
+        if (++row > row_end) {
+            row = row_start;
+        }
+    }
+}
+
+
+/**
+ * @brief Decode a byte of pixel data in the current color format.
+ *
+ * @param[in] byte Byte received after RAMWR.
+ */
+static void write_pixel_byte(const uint8_t byte)
+{
+    pixel_bytes[num_pixel_bytes++] = byte;
+    switch (colmod & 0x07) {
+        case 0x03:
+            // 12-bit: R1G1 B1R2 G2B2
+            if (num_pixel_bytes == 3) {
+                write_pixel(((pixel_bytes[0] >> 4) << 12) | ((pixel_bytes[0] & 0x0F) << 7)
+                            | ((pixel_bytes[1] >> 4) << 1));
+                write_pixel(((pixel_bytes[1] & 0x0F) << 12) | ((pixel_bytes[2] >> 4) << 7)
+                            | ((pixel_bytes[2] & 0x0F) << 1));
+                num_pixel_bytes = 0;
+            }
+            break;
+        case 0x05:
+            // 16-bit: RRRRRGGG GGGBBBBB
+            if (num_pixel_bytes == 2) {
+                write_pixel((pixel_bytes[0] << 8) | pixel_bytes[1]);
+                num_pixel_bytes = 0;
+            }
+            break;
+        default:
+            // 18-bit: RRRRRR-- GGGGGG-- BBBBBB--
+            if (num_pixel_bytes == 3) {
+                write_pixel(((pixel_bytes[0] >> 3) << 11) | ((pixel_bytes[1] >> 2) << 5)
+                            | (pixel_bytes[2] >> 3));
+                num_pixel_bytes = 0;
+            }
+            break;
+    }
+}
+
+
+/**
+ * @brief Decode a command byte (D/C low).
+ *
+ * @param[in] byte Command.
+ */
+static void write_command(const uint8_t byte)
+{
+    command = byte;
+    num_parameters = 0;
+    writing = 0;
+    stats.commands++;
+    switch (command) {
+        case EMU_SWRESET:
+            reset_controller();
+            break;
+        case EMU_DISPOFF:
+            display_on = 0;
+            break;
+        case EMU_DISPON:
+            display_on = 1;
+            break;
+        case EMU_INVOFF:
+            inverted = 0;
+            break;
+        case EMU_INVON:
+            inverted = 1;
+            break;
+        case EMU_TEOFF:
+            te_on = 0;
+            break;
+        case EMU_RAMWR:
+            writing = 1;
+            column = column_start;
+            row = row_start;
+            num_pixel_bytes = 0;
+            stats.ramwr++;
+            break;
+        default:
+            break;
+    }
+}
+
+
+/**
+ * @brief Decode a parameter byte (D/C high) of the current command.
+ *
+ * @param[in] byte Parameter.
+ */
+static void write_parameter(const uint8_t byte)
+{
+    if (writing) {
+        write_pixel_byte(byte);
+        return;
+    }
+    if (num_parameters >= EMU_MAX_PARAMETERS) {
+        return;
+    }
+    parameters[num_parameters++] = byte;
+    switch (command) {
+        case EMU_CASET:
+            if (num_parameters == 4) {
+                column_start = (parameters[0] << 8) | parameters[1];
+                column_end = (parameters[2] << 8) | parameters[3];
+            }
+            break;
+        case EMU_RASET:
+            if (num_parameters == 4) {
+                row_start = (parameters[0] << 8) | parameters[1];
+                row_end = (parameters[2] << 8) | parameters[3];
+            }
+            break;
+        case EMU_MADCTL:
+            madctl = parameters[0];
+            break;
+        case EMU_COLMOD:
+            colmod = parameters[0];
+            break;
+        case EMU_TEON:
+            te_on = 1;
+            break;
+        case EMU_VSCRDEF:
+            if (num_parameters == 6) {
+                tfa = (parameters[0] << 8) | parameters[1];
+                vsa = (parameters[2] << 8) | parameters[3];
+                bfa = (parameters[4] << 8) | parameters[5];
+            }
+            break;
+        case EMU_VSCSAD:
+            if (num_parameters == 2) {
+                ssa = (parameters[0] << 8) | parameters[1];
+                stats.scrolls++;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+
+/**
+ * @brief Execute a transaction on the emulated bus, D/C being sampled after
+ * the pre-transaction callback.
+ *
+ * @param[in] trans Transaction to execute.
+ */
+static void execute_transaction(spi_transaction_t *trans)
+{
+    if (device.pre_cb != NULL) {
+        device.pre_cb(trans);
+    }
+    const uint8_t *data = (trans->flags & SPI_TRANS_USE_TXDATA) ?
+                          trans->tx_data : trans->tx_buffer;
+    const size_t num_bytes = trans->length / 8;
+    stats.transactions++;
+    stats.bytes += num_bytes;
+    stats.bus_ns += (uint64_t)trans->length * 1000000000ULL / device.clock_speed_hz;
+    for (size_t i = 0; i < num_bytes; i++) {
+        if (dc_level) {
+            write_parameter(data[i]);
+        }
+        else {
+            write_command(data[i]);
+        }
+    }
+    if (device.post_cb != NULL) {
+        device.post_cb(trans);
+    }
+}
+
+
+/**
+ * @brief Check a transaction against the limits of the bus.
+ *
+ * @param[in] func Name of the calling function.
+ * @param[in] trans Transaction to check.
+ * @return ESP_OK if the transaction can be sent.
+ */
+static esp_err_t check_transaction(const char *func, const spi_transaction_t *trans)
+{
+    if (trans == NULL || trans->length % 8) {
+        printf("Error(%s): invalid transaction.\n", func);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (trans->length / 8 > max_transfer_size) {
+        printf("Error(%s): %zu bytes exceed the maximum transfer size (%zu).\n",
+               func, trans->length / 8, max_transfer_size);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!(trans->flags & SPI_TRANS_USE_TXDATA) && trans->length && trans->tx_buffer == NULL) {
+        printf("Error(%s): tx_buffer is NULL.\n", func);
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+
+/*************************************************
+ * spi_master and gpio API
+ *************************************************/
+
+esp_err_t spi_bus_initialize(spi_host_device_t host_id,
+                             const spi_bus_config_t *bus_config,
+                             spi_common_dma_t dma_chan)
+{
+    if (bus_config->max_transfer_sz) {
+        max_transfer_size = bus_config->max_transfer_sz;
+    }
+    else {
+        max_transfer_size = dma_chan ? EMU_DMA_TRANSFER : EMU_CPU_TRANSFER;
+    }
+    return ESP_OK;
+}
+
+
+esp_err_t spi_bus_add_device(spi_host_device_t host_id,
+                             const spi_device_interface_config_t *dev_config,
+                             spi_device_handle_t *handle)
+{
+    if (dev_config->queue_size > EMU_MAX_QSIZE || dev_config->clock_speed_hz <= 0) {
+        printf("Error(spi_bus_add_device): unsupported device configuration.\n");
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(&device, 0, sizeof(device));
+    device.clock_speed_hz = dev_config->clock_speed_hz;
+    device.queue_size = dev_config->queue_size;
+    device.pre_cb = dev_config->pre_cb;
+    device.post_cb = dev_config->post_cb;
+    reset_controller();
+    *handle = &device;
+    return ESP_OK;
+}
+
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle,
+                                 spi_transaction_t *trans_desc,
+                                 uint32_t ticks_to_wait)
+{
+    const esp_err_t err = check_transaction(__func__, trans_desc);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (handle->in_flight >= handle->queue_size) {
+        // The device would block forever, as nothing retrieves the results
+        printf("Error(spi_device_queue_trans): queue full (%d transactions).\n",
+               handle->queue_size);
+        return ESP_ERR_TIMEOUT;
+    }
+    handle->queue[(handle->first + handle->in_flight) % EMU_MAX_QSIZE] = trans_desc;
+    handle->in_flight++;
+    stats.queued++;
+    return ESP_OK;
+}
+
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle,
+                                      spi_transaction_t **trans_desc,
+                                      uint32_t ticks_to_wait)
+{
+    if (handle->in_flight == 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+    *trans_desc = handle->queue[handle->first];
+    handle->first = (handle->first + 1) % EMU_MAX_QSIZE;
+    handle->in_flight--;
+    execute_transaction(*trans_desc);
+    return ESP_OK;
+}
+
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle,
+                              spi_transaction_t *trans_desc)
+{
+    spi_transaction_t *result = NULL;
+    const esp_err_t err = spi_device_queue_trans(handle, trans_desc, portMAX_DELAY);
+    if (err != ESP_OK) {
+        return err;
+    }
+    // Previously queued transactions complete first
+    while (result != trans_desc) {
+        spi_device_get_trans_result(handle, &result, portMAX_DELAY);
+    }
+    return ESP_OK;
+}
+
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle,
+                                      spi_transaction_t *trans_desc)
+{
+    const esp_err_t err = check_transaction(__func__, trans_desc);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (handle->in_flight) {
+        printf("Error(spi_device_polling_transmit): %u queued transactions not finished.\n",
+               handle->in_flight);
+        return ESP_ERR_INVALID_STATE;
+    }
+    execute_transaction(trans_desc);
+    stats.polled++;
+    return ESP_OK;
+}
+
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if (gpio_num == EMU_PIN_DC) {
+        if ((level != 0) != dc_level) {
+            stats.dc_toggles++;
+        }
+        dc_level = (level != 0);
+    }
+    return ESP_OK;
+}
+
+
+/*************************************************
+ * Emulator API
+ *************************************************/
+
+void st7735s_emu_get_stats(emu_stats_t *stats_out)
+{
+    *stats_out = stats;
+}
+
+
+void st7735s_emu_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+
+uint16_t st7735s_emu_get_pixel(const uint8_t x, const uint8_t y)
+{
+    // Gate line scanned at this position, then scrolled within the scroll area
+    uint16_t line = EMU_GRAM_HEIGHT - 1 - x;
+    if (vsa && line >= tfa && line < tfa + vsa) {
+        line = tfa + (line - tfa + ssa - tfa + vsa) % vsa;
+    }
+    uint16_t color = (line < EMU_GRAM_HEIGHT && y < EMU_GRAM_WIDTH) ? gram[line][y] : 0;
+    if (madctl & EMU_MADCTL_BGR) {
+        color = (color & 0x07E0) | (color >> 11) | (color << 11);
+    }
+    if (inverted) {
+        color = ~color;
+    }
+    return display_on ? color : 0x0000;
+}
+
+
+uint32_t st7735s_emu_hash(const uint16_t mask)
+{
+    uint32_t hash = 2166136261u;
+    for (uint8_t y = 0; y < EMU_VIEW_HEIGHT; y++) {
+        for (uint8_t x = 0; x < EMU_VIEW_WIDTH; x++) {
+            const uint16_t color = st7735s_emu_get_pixel(x, y) & mask;
+            hash = (hash ^ (color & 0xFF)) * 16777619u;
+            hash = (hash ^ (color >> 8)) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+
+int st7735s_emu_dump_ppm(const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        printf("Error(st7735s_emu_dump_ppm): cannot open %s.\n", path);
+        return -1;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", EMU_VIEW_WIDTH, EMU_VIEW_HEIGHT);
+    for (uint8_t y = 0; y < EMU_VIEW_HEIGHT; y++) {
+        for (uint8_t x = 0; x < EMU_VIEW_WIDTH; x++) {
+            const uint16_t color = st7735s_emu_get_pixel(x, y);
+            const uint8_t rgb[3] = {
+                ((color >> 11) & 0x1F) << 3 | ((color >> 13) & 0x07),
+                ((color >> 5) & 0x3F) << 2 | ((color >> 9) & 0x03),
+                (color & 0x1F) << 3 | ((color >> 2) & 0x07)
+            };
+            fwrite(rgb, 1, sizeof(rgb), file);
+        }
+    }
+    fclose(file);
+    return 0;
+}
@@ -30,15 +30,15 @@ void app_main()
 {
     // Hardware initialization
     #pragma region
-    nimBLE_client_initialize_ble();
-    // Initialize LCD display
+    log_boot_phase("app_main");
+    /* Initialize LCD display. The display is brought up in the background
+     while the rest of the console is initialized. */
     spi_device_handle_t tft_handle;
     st7735s_init_spi(&tft_handle);
-    st7735s_init_tft(tft_handle);
-    st7735s_fill_background(BLACK);
-    st7735s_push_frame(tft_handle);
+    st7735s_start_tft(tft_handle);
     st7735s_init_pwm_backlight();
-    st7735s_set_backlight(100);
+    nimBLE_client_initialize_ble();
+    log_boot_phase("BLE initialized");
     // Initialize buzzer
     mhfmd_init_pwm();
     // Initialize timer instance
@@ -51,6 +51,7 @@ void app_main()
     ESP_ERROR_CHECK(gptimer_new_timer(&timer_config, &timer_handle));
     ESP_ERROR_CHECK(gptimer_enable(timer_handle));
     ESP_ERROR_CHECK(gptimer_start(timer_handle));
+    log_boot_phase("hardware initialized");
     #pragma endregion
     
     // Game initialization & UI
@@ -59,50 +60,11 @@ void app_main()
         .running = 1,
         .map = &map_shire
     };
-    const char coins_text[] = "COIN: ";
-    const text_t coins_text_object = {
-        .pos_x = 5,
-        .pos_y = 5,
-        .size = sizeof(coins_text),
-        .data = coins_text,
-        .color = BLACK,
-        .adaptive = 1,
-        .font = myFont
-    };
-    char num_coins_text[4] = {'\0'};
-    const text_t coins_object = {
-        .pos_x = 5 + sizeof(coins_text) * FONT_SIZE,
-        .pos_y = 5,
-        .size = sizeof(num_coins_text),
-        .data = num_coins_text,
-        .color = BLACK,
-        .adaptive = 1,
-        .font = myFont
-    };
-    const char life_text[] = "LIFE: ";
-    const text_t life_text_object = {
-        .pos_x = LCD_WIDTH / 2,
-        .pos_y = 5,
-        .size = sizeof(life_text),
-        .data = life_text,
-        .color = BLACK,
-        .adaptive = 1,
-        .font = myFont
-    };
-    char num_life_text[3] = {'\0'};
-    const text_t life_object = {
-        .pos_x = LCD_WIDTH / 2 + sizeof(life_text) * FONT_SIZE,
-        .pos_y = 5,
-        .size = sizeof(num_life_text),
-        .data = num_life_text,
-        .color = BLACK,
-        .adaptive = 1,
-        .font = myFont
-    };
     // Initialize and load game elements
     reset_records();
     load_platforms(game.map);
     spawn_enemies(game.map, game.cam_pos_x, game.cam_row, game.cam_row + NUM_BLOCKS_X + 1);
+    log_boot_phase("game loaded");
     music_t *cued_music = NULL;
     // Create the player's character
     player_t player = {
@@ -117,8 +79,17 @@ void app_main()
         .physics.speed_y    = SPEED_INITIAL,
         .sprite.height      = BLOCK_SIZE,
         .sprite.width       = BLOCK_SIZE,
-        .sprite.data        = sprite_player
+        .sprite.indexed     = &sprite_player
     };
+    // Clear the display once initialized, before switching the backlight on
+    st7735s_wait_tft();
+    log_boot_phase("display initialized");
+    st7735s_set_frame_rate(tft_handle, REFRESH_RATE);
+    st7735s_fill_background(BLACK);
+    st7735s_update_display(tft_handle);
+    st7735s_wait_frame(tft_handle);
+    st7735s_set_backlight(100);
+    log_boot_phase("first frame");
     #pragma endregion
     
     // Start menu
@@ -132,6 +103,7 @@ void app_main()
         if (!played_once && play_music(&game, &music_intro)) {
             played_once = 1;
         }
+        st7735s_fill_background(BLACK);
         const char menu_txt1[] = "THE LORD OF\nTHE FAKE RING";
         const text_t menu_txt1_obj = {
             .color = ORANGE,
@@ -152,171 +124,68 @@ void app_main()
             .size = sizeof(menu_txt2)
         };
         st7735s_draw_text(&menu_txt2_obj);
-        st7735s_push_frame(tft_handle);
+        st7735s_update_display(tft_handle);
+        st7735s_wait_frame(tft_handle);
         feed_watchdog_timer();
     }
     flush_music(&music_intro);
     mhfmd_set_buzzer(0);
 
-    // Game loop
-    uint64_t fps_timer = 0;
+    /* Game loop. Its rate is set by st7735s_update_display(), which waits
+     for the next refresh of the display (see st7735s_set_frame_rate()). */
     while(!game.over) {
         // Get the time for the current iteration
         ESP_ERROR_CHECK(gptimer_get_raw_count(timer_handle, &game.timer));
         game.timer = (uint64_t)game.timer / 10; // Convert to milliseconds
 
-        // Cap the refresh rate
-        if ((float)1000 / (game.timer - fps_timer) > REFRESH_RATE + 1) {
-            continue;
-        }
-        fps_timer = game.timer;
-
         // Read gamepad from BLE server
         nimBLE_client_read_gamepad();
+        const game_input_t input = {
+            .jump   = ble_button_C.pushed,
+            .fire   = ble_button_A.pushed,
+            .axis_x = ble_axis_X
+        };
 
-        // Compute all game parameters & objects
-        if (game.running) {
-            // Compute player
-            check_player_state(&game, &player, ble_button_C.pushed);
-            if (player.lightstaff && ble_button_A.pushed) {
-                cued_music = &music_glamdring_blast;
-                player.power_used = 1;
-            }
-            update_player_position(&game, &player, ble_axis_X);
-            if (check_block_collisions(game.map, &player.physics, &cued_music, game.cam_row)) {
-                apply_reactive_force(&player.physics);
-            }
-            for (uint8_t i = 0; i < MAX_PLATFORMS; i++) {
-                update_platform_position(&game, &platforms[i]);
-                if (check_platform_collision(&player.physics, &platforms[i])) {
-                    player.physics.platform_i = i;
-                    player.physics.pos_y -= player.physics.speed_y; // reactive force
-                    // If moving, follow the movement of the platform
-                    if (platforms[i].moved && platforms[i].horizontal) {
-                        player.physics.pos_x += platforms[i].physics.speed_x;
-                    }
-                    else if (platforms[i].moved && platforms[i].vertical) {
-                        player.physics.pos_y += platforms[i].physics.speed_y;
-                    }
-                }
-            }
-            // Compute interactive blocks that have been hit by the player
-            for (uint8_t i = 0; i < NUM_BLOCK_RECORDS; i++) {
-                if (!blocks[i].is_hit || blocks[i].row == -1 || blocks[i].column == -1) {
-                    continue;
-                }
-                compute_interactive_block(&game, &blocks[i]);
-            }
-            // Compute items
-            for (uint8_t i = 0; i < NUM_ITEMS; i++) {
-                if (is_player_collecting_item(&game, &player, &items[i])) {
-                    collect_item(&player, &items[i]);
-                }
-            }
-            // Spawn & compute enemies
-            spawn_enemies(game.map, game.cam_pos_x, SPAWN_START(game.cam_row), SPAWN_END(game.cam_row) + 1);
-            for (int i = 0; i < NUM_ENEMY_RECORDS; i++) {
-                compute_enemy(&game, &player, &enemies[i], &cued_music);
-            }
-            // Compute projectiles
-            for (uint8_t i = 0; i < MAX_PROJECTILES; i++) {
-                compute_projectile(&game, &player, &projectiles[i]);
-            }
-        }
-
-        // Play music
-        if (cued_music != NULL && play_music(&game, cued_music)) {
-            cued_music = NULL; // No more music to play for now
-        }
-
-        // Build the frame
-        build_frame(&game, &player);
-        st7735s_draw_text(&coins_text_object);
-        st7735s_draw_text(&life_text_object);
-        sprintf(num_coins_text, "%i", (uint8_t)game.coins + player.coins);
-        sprintf(num_life_text, "%i", (uint8_t)player.life);
-        st7735s_draw_text(&coins_object);
-        st7735s_draw_text(&life_object);
-        draw_player(&game, &player);
-        
-        // Check & update game state
-        #pragma region
-        if (!game.running || game.map->end_row * BLOCK_SIZE < player.physics.pos_x) {
-            switch (game.map->id) {
-                case SHIRE:
-                    game.running = 0;
-                    if (transition_screen(BLACK, 1)) {
-                        const char transition_txt[] = "THE MINES\nOF MORIA";
-                        const text_t transition_txt_obj = {
-                            .color = LIGHT_BLUE,
-                            .font = myFont,
-                            .pos_x = LCD_WIDTH / 2 - FONT_SIZE * 5,
-                            .pos_y = LCD_HEIGHT / 2 - TEXT_PADDING_Y / 2 - FONT_SIZE,
-                            .data = transition_txt,
-                            .size = sizeof(transition_txt)
-                        };
-                        st7735s_draw_text(&transition_txt_obj);
-                        st7735s_push_frame(tft_handle);
-                        ets_delay_us(4*1000*1000);
-                        game.init = 1;
-                        game.map = &map_moria;
-                    }
-                    break;
-                case MORIA:
-                    game.running = 0; 
-                    if (player.physics.pos_x == game.map->start_row * BLOCK_SIZE) {
-                        if (transition_screen(BLACK, 0)) {
-                            game.running = 1;
-                        }
-                    }
-                    else if (transition_screen(WHITE, 1)) {
-                        const char transition_txt[] = "THE FOREST\nOF LORIEN\n\n\nTO BE\nCONTINUED...";
-                        const text_t transition_txt_obj = {
-                            .color = DARK_GREEN,
-                            .font = myFont,
-                            .pos_x = LCD_WIDTH / 2 - FONT_SIZE * 6,
-                            .pos_y = LCD_HEIGHT / 2 - 3 * (TEXT_PADDING_Y / 2 + FONT_SIZE),
-                            .data = transition_txt,
-                            .size = sizeof(transition_txt)
-                        };
-                        st7735s_draw_text(&transition_txt_obj);
-                        st7735s_push_frame(tft_handle);
-                        game.over = 1;
-                    }
-                    break;
-            }
+        // Compute and draw the frame, as the host benchmark does
+        const uint8_t events = play_frame(&game, &player, &input, &cued_music);
+        if (events & MAP_COMPLETED) {
+            const char transition_txt[] = "THE MINES\nOF MORIA";
+            const text_t transition_txt_obj = {
+                .color = LIGHT_BLUE,
+                .font = myFont,
+                .pos_x = LCD_WIDTH / 2 - FONT_SIZE * 5,
+                .pos_y = LCD_HEIGHT / 2 - TEXT_PADDING_Y / 2 - FONT_SIZE,
+                .data = transition_txt,
+                .size = sizeof(transition_txt)
+            };
+            st7735s_draw_text(&transition_txt_obj);
+            st7735s_update_display(tft_handle);
+            st7735s_wait_frame(tft_handle);
+            ets_delay_us(4*1000*1000);
         }
-        if (player.life == 0) {
-            game.over = 1;
-            ets_delay_us(1*1000*1000);
+        else if (events & GAME_COMPLETED) {
+            const char transition_txt[] = "THE FOREST\nOF LORIEN\n\n\nTO BE\nCONTINUED...";
+            const text_t transition_txt_obj = {
+                .color = DARK_GREEN,
+                .font = myFont,
+                .pos_x = LCD_WIDTH / 2 - FONT_SIZE * 6,
+                .pos_y = LCD_HEIGHT / 2 - 3 * (TEXT_PADDING_Y / 2 + FONT_SIZE),
+                .data = transition_txt,
+                .size = sizeof(transition_txt)
+            };
+            st7735s_draw_text(&transition_txt_obj);
+            st7735s_update_display(tft_handle);
+            st7735s_wait_frame(tft_handle);
         }
-        else if (game.reset) {
-            reset_game_flags(&game);
-            reset_player(&game, &player);
-            reset_records();
-            load_platforms(game.map);
-            spawn_enemies(game.map, game.cam_pos_x, game.cam_row, game.cam_row + NUM_BLOCKS_X);
+        if (events & (PLAYER_DEAD | PLAYER_RESET)) {
             ets_delay_us(1*1000*1000);
         }
-        else if (game.init) {
-            game.coins              += player.coins;
-            player.coins            = 0;
-            player.physics.pos_x    = game.map->start_row * BLOCK_SIZE;
-            player.physics.pos_y    = (NUM_BLOCKS_Y - game.map->start_column - 1) * BLOCK_SIZE;
-            player.physics.speed_x  = SPEED_INITIAL;
-            player.physics.speed_y  = SPEED_INITIAL;
-            player.physics.falling  = 0;
-            player.physics.jumping  = 0;
-            reset_game_flags(&game);
-            reset_records();
-            load_platforms(game.map);
-            spawn_enemies(game.map, game.cam_pos_x, game.cam_row, game.cam_row + NUM_BLOCKS_X);
-        }
-        reset_hit_flag_blocks();
-        #pragma endregion
 
-        // Send the frame to the display
-        st7735s_push_frame(tft_handle);
+        /* Send the changes of the frame to the display. The transfer runs in
+         the background while the next frame is being built. The transitions
+         redraw the whole frame: trade color depth for frame rate. */
+        st7735s_set_color_format(tft_handle, game.running ? LCD_COLOR_FORMAT_16 : LCD_COLOR_FORMAT_12);
+        st7735s_update_display(tft_handle);
         feed_watchdog_timer();
     }
 
@@ -333,7 +202,8 @@ void app_main()
         };
         st7735s_fill_background(BLACK);
         st7735s_draw_text(&game_over_txt_obj);
-        st7735s_push_frame(tft_handle);
+        st7735s_update_display(tft_handle);
+        st7735s_wait_frame(tft_handle);
     }
     return;
 }
\ No newline at end of file
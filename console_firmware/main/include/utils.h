@@ -6,5 +6,13 @@
  */
 void feed_watchdog_timer(void);
 
+/**
+ * @brief Log the time elapsed since boot at the given phase of the boot,
+ * to measure the boot-to-first-frame time.
+ * 
+ * @param[in] phase Name of the boot phase reached.
+ */
+void log_boot_phase(const char *phase);
+
 
 #endif // __UTILS_H__
\ No newline at end of file
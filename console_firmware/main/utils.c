@@ -1,7 +1,10 @@
 #include "utils.h"
 
+#include <stdio.h>
+
 #include "soc/timer_group_struct.h"
 #include "soc/timer_group_reg.h"
+#include "esp_timer.h"
 
 
 void feed_watchdog_timer(void)
@@ -9,4 +12,10 @@ void feed_watchdog_timer(void)
     TIMERG0.wdtwprotect.wdt_wkey = TIMG_WDT_WKEY_VALUE;
     TIMERG0.wdtfeed.wdt_feed = 1;
     TIMERG0.wdtwprotect.wdt_wkey = 0;
-}
\ No newline at end of file
+}
+
+
+void log_boot_phase(const char *phase)
+{
+    printf("Boot(timing): %s at %lld us\n", phase, esp_timer_get_time());
+}